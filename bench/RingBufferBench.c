@@ -0,0 +1,141 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Measures RingBuffer transfers with and without non-temporal stores and
+ * prefetching.
+ *
+ * Usage: RingBufferBench [len [streaming threshold [prefetch threshold]]]
+ *
+ * Each round fills a 64 MiB ring buffer with writes of @c len bytes, sums a
+ * 1 MiB working set, and drains the ring buffer with reads of @c len bytes.
+ * The time to sum the working set shows how much of it the writes evicted from
+ * the caches. The positions start half a write into the data memory, so that
+ * writes and reads wrap around its end, where prefetching applies.
+ *
+ * The runs use neither threshold, each one alone, and both.
+ */
+
+#include "RingBuffer.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MIB ((size_t)1 << 20)
+#define BENCH_CAPACITY (64 * MIB)
+#define BENCH_HOT_SIZE (1 * MIB)
+#define BENCH_ROUNDS 20
+
+static double now(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static uint64_t sum(const uint64_t *hot, size_t count) {
+    uint64_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        total += hot[i];
+    }
+    return total;
+}
+
+static uint64_t run(const char *name, RingBuffer *rb, uint8_t *payload,
+                    size_t len, const uint64_t *hot) {
+    size_t count = BENCH_HOT_SIZE / sizeof(*hot);
+    size_t bytes = 0;
+    double wtime = 0;
+    double rtime = 0;
+    double htime = 0;
+    uint64_t total = 0;
+    RingBuffer_reset(rb);
+    RingBuffer_writeBytes(rb, payload, len / 2);
+    RingBuffer_discardBytes(rb, len / 2);
+    for (size_t r = 0; r < BENCH_ROUNDS; ++r) {
+        total += sum(hot, count);
+
+        double start = now();
+        while (RingBuffer_getWriteByteCapacity(rb) >= len) {
+            bytes += RingBuffer_writeBytes(rb, payload, len);
+        }
+        wtime += now() - start;
+
+        start = now();
+        total += sum(hot, count);
+        htime += now() - start;
+
+        start = now();
+        while (RingBuffer_readBytes(rb, payload, len) > 0) {
+        }
+        rtime += now() - start;
+    }
+    printf("%-10s write %6.2f GB/s  read %6.2f GB/s  working set %8.1f us\n",
+           name, (double)bytes / wtime * 1e-9, (double)bytes / rtime * 1e-9,
+           htime / BENCH_ROUNDS * 1e6);
+    return total;
+}
+
+int main(int argc, char *argv[]) {
+    size_t len = (argc > 1) ? (size_t)strtoull(argv[1], NULL, 0) : 4 * MIB;
+    size_t stmin = (argc > 2) ? (size_t)strtoull(argv[2], NULL, 0) : MIB;
+    size_t pfmin = (argc > 3) ? (size_t)strtoull(argv[3], NULL, 0) : MIB;
+    if ((len == 0) || (len > BENCH_CAPACITY)) {
+        fprintf(stderr, "Usage: %s [len [streaming threshold "
+                        "[prefetch threshold]]]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    uint8_t *data = (uint8_t *)malloc(BENCH_CAPACITY);
+    uint8_t *payload = (uint8_t *)malloc(len);
+    uint64_t *hot = (uint64_t *)malloc(BENCH_HOT_SIZE);
+    if ((data == NULL) || (payload == NULL) || (hot == NULL)) {
+        fprintf(stderr, "Out of memory\n");
+        return EXIT_FAILURE;
+    }
+    memset(data, 0, BENCH_CAPACITY);
+    memset(payload, 1, len);
+    memset(hot, 2, BENCH_HOT_SIZE);
+
+    RingBuffer rb;
+    RingBuffer_initialize(&rb, data, BENCH_CAPACITY);
+    printf("len %zu, streaming threshold %zu, prefetch threshold %zu\n", len,
+           stmin, pfmin);
+    uint64_t total = run("cached", &rb, payload, len, hot);
+    RingBuffer_setStreamingThreshold(&rb, stmin);
+    total += run("streaming", &rb, payload, len, hot);
+    RingBuffer_setStreamingThreshold(&rb, 0);
+    RingBuffer_setPrefetchThreshold(&rb, pfmin);
+    total += run("prefetch", &rb, payload, len, hot);
+    RingBuffer_setStreamingThreshold(&rb, stmin);
+    total += run("both", &rb, payload, len, hot);
+
+    free(hot);
+    free(payload);
+    free(data);
+    return (total != 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
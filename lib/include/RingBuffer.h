@@ -32,10 +32,35 @@ SOFTWARE.
 #ifndef _RINGBUFFER_H
 #define _RINGBUFFER_H
 
+#include "RingBufferConfig.h"
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+/**
+ * The data memory allocator of a growable ring buffer.
+ *
+ * Any number of ring buffers may share an allocator, which must outlive them.
+ */
+typedef struct {
+    /// Allocates @p size bytes of data memory, or returns @c NULL.
+    void *(*allocate)(void *ctx, size_t size);
+    /// Frees @p size bytes of data memory from the allocate function.
+    void (*deallocate)(void *ctx, void *data, size_t size);
+    void *ctx;     ///< The context passed to the functions.
+    size_t minCap; ///< The initial and smallest capacity in bytes.
+    size_t maxCap; ///< The largest capacity in bytes, or zero for no limit.
+} RingBufferAllocator;
+
+/**
+ * A function that releases the physical memory of the whole pages in @p len
+ * bytes of data memory at @p data, such as RingBufferReclaim_releasePages().
+ *
+ * The @p mirrored parameter tells whether the data memory is mirrored, and
+ * therefore shared. Returns the number of bytes released.
+ */
+typedef size_t (*RingBufferReclaimer)(void *data, size_t len, bool mirrored);
+
 /**
  * A ring buffer.
  *
@@ -44,11 +69,30 @@ SOFTWARE.
 typedef struct {
     uint8_t *_data;
     size_t _cap;
+    size_t _mask;
     size_t _wpos;
     size_t _rpos;
     size_t _len;
+    size_t _resv;
+    size_t _stmin;
+    size_t _pfmin;
+    const RingBufferAllocator *_alloc;
+    size_t _peak;
+    unsigned _drains;
+    RingBufferReclaimer _reclaim;
+    size_t _rcmin;
+    size_t _hot;
+    unsigned _flags;
 } RingBuffer;
 
+/**
+ * A contiguous region of a ring buffer's data memory.
+ */
+typedef struct {
+    uint8_t *data; ///< The first byte of the region.
+    size_t len;    ///< The number of bytes in the region.
+} RingBufferSegment;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -56,6 +100,9 @@ extern "C" {
 /**
  * Initializes the ring buffer.
  *
+ * A power-of-two capacity lets the ring buffer wrap its positions with a mask
+ * instead of comparisons.
+ *
  * @param[out]      rb      The ring buffer, must not be @c NULL.
  * @param[in,out]   data    The data memory, or external memory for storing the
  *                          data, must not be @c NULL.
@@ -64,18 +111,93 @@ extern "C" {
  * @retval  false   A parameter is invalid.
  * @retval  true    Success.
  */
-inline bool RingBuffer_initialize(RingBuffer *rb, void *data, size_t cap) {
+RINGBUFFER_INLINE bool RingBuffer_initialize(RingBuffer *rb, void *data,
+                                             size_t cap) {
     if ((rb == NULL) || (data == NULL) || (cap == 0)) {
         return false;
     }
     rb->_data = (uint8_t *)data;
     rb->_cap = cap;
+    rb->_mask = ((cap & (cap - 1)) == 0) ? (cap - 1) : 0;
     rb->_wpos = 0;
     rb->_rpos = 0;
     rb->_len = 0;
+    rb->_resv = 0;
+    rb->_stmin = 0;
+    rb->_pfmin = 0;
+    rb->_alloc = NULL;
+    rb->_peak = 0;
+    rb->_drains = 0;
+    rb->_reclaim = NULL;
+    rb->_rcmin = 0;
+    rb->_hot = cap;
+    rb->_flags = 0;
     return true;
 }
 
+/**
+ * Initializes the ring buffer with mirrored data memory.
+ *
+ * The data memory must be followed by a second mapping of the same memory, so
+ * that <code>data[i]</code> and <code>data[cap + i]</code> are the same byte,
+ * such as memory from RingBufferMirror_allocate(). The ring buffer then
+ * accesses any number of bytes up to its capacity in one contiguous piece:
+ * writes, reads and peeks copy without splitting, the span functions return
+ * the write and read capacities, and the segment functions return a single
+ * region.
+ *
+ * @param[out]      rb      The ring buffer, must not be @c NULL.
+ * @param[in,out]   data    The mirrored data memory, must not be @c NULL.
+ * @param[in]       cap     The data memory capacity in bytes, not counting the
+ *                          mirror, must not be zero.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+RINGBUFFER_EXTERN bool RingBuffer_initializeMirrored(RingBuffer *rb, void *data,
+                                                     size_t cap);
+
+/**
+ * Initializes a growable ring buffer with data memory from an allocator.
+ *
+ * The ring buffer starts with the allocator's minimum capacity. When a write
+ * or a reservation does not fit, the ring buffer doubles its capacity as often
+ * as needed, up to the allocator's maximum capacity, and moves its readable
+ * bytes to the start of the new data memory. When the ring buffer drains
+ * repeatedly without its occupancy reaching a quarter of its capacity, it
+ * halves its capacity, down to the minimum. A reservation that does not fit
+ * only doubles the capacity once, since its length is an upper bound. Without
+ * a maximum capacity, the capacity stops growing at half the largest object
+ * size. A failed allocation leaves the capacity as it is. Otherwise the ring
+ * buffer behaves as any other, except that a write that changes the capacity
+ * frees the old data memory, which invalidates the regions returned by
+ * RingBuffer_peekSegments() and RingBuffer_peekSegmentsAt().
+ *
+ * Free the data memory with RingBuffer_freeMemory().
+ *
+ * @param[out]  rb      The ring buffer, must not be @c NULL.
+ * @param[in]   alloc   The allocator, must not be @c NULL, and its minimum
+ *                      capacity must not be zero nor exceed its maximum.
+ *
+ * @retval  false   A parameter is invalid or the allocation failed.
+ * @retval  true    Success.
+ */
+RINGBUFFER_EXTERN bool
+RingBuffer_initializeGrowable(RingBuffer *rb, const RingBufferAllocator *alloc);
+
+/**
+ * Frees the data memory of a growable ring buffer.
+ *
+ * The ring buffer must be initialized again before any further use.
+ *
+ * @param[in,out]   rb  The growable ring buffer, must not be @c NULL.
+ *
+ * @retval  false   The @p rb parameter is @c NULL or the ring buffer is not
+ *                  growable.
+ * @retval  true    Success.
+ */
+RINGBUFFER_EXTERN bool RingBuffer_freeMemory(RingBuffer *rb);
+
 /**
  * Resets the ring buffer.
  *
@@ -84,13 +206,14 @@ inline bool RingBuffer_initialize(RingBuffer *rb, void *data, size_t cap) {
  * @retval  false   The @p rb parameter is @c NULL.
  * @retval  true    Success.
  */
-inline bool RingBuffer_reset(RingBuffer *rb) {
-    if (rb == NULL) {
+RINGBUFFER_INLINE bool RingBuffer_reset(RingBuffer *rb) {
+    if (RINGBUFFER_ISNULL(rb)) {
         return false;
     }
     rb->_len = 0;
     rb->_rpos = 0;
     rb->_wpos = 0;
+    rb->_resv = 0;
     return true;
 }
 
@@ -101,8 +224,8 @@ inline bool RingBuffer_reset(RingBuffer *rb) {
  *
  * @param[in]   rb  The ring buffer, must not be @c NULL.
  */
-inline void *RingBuffer_getDataPointer(const RingBuffer *rb) {
-    return (rb != NULL) ? rb->_data : NULL;
+RINGBUFFER_INLINE void *RingBuffer_getDataPointer(const RingBuffer *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? rb->_data : NULL;
 }
 
 /**
@@ -112,8 +235,8 @@ inline void *RingBuffer_getDataPointer(const RingBuffer *rb) {
  *
  * @param[in]   rb  The ring buffer, must not be @c NULL.
  */
-inline size_t RingBuffer_getByteCapacity(const RingBuffer *rb) {
-    return (rb != NULL) ? rb->_cap : 0;
+RINGBUFFER_INLINE size_t RingBuffer_getByteCapacity(const RingBuffer *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? rb->_cap : 0;
 }
 
 /**
@@ -124,8 +247,8 @@ inline size_t RingBuffer_getByteCapacity(const RingBuffer *rb) {
  *
  * @param[in]   rb  The ring buffer, must not be @c NULL.
  */
-inline size_t RingBuffer_getWriteByteCapacity(const RingBuffer *rb) {
-    return (rb != NULL) ? (rb->_cap - rb->_len) : 0;
+RINGBUFFER_INLINE size_t RingBuffer_getWriteByteCapacity(const RingBuffer *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? (rb->_cap - rb->_len) : 0;
 }
 
 /**
@@ -136,10 +259,27 @@ inline size_t RingBuffer_getWriteByteCapacity(const RingBuffer *rb) {
  *
  * @param[in]   rb  The ring buffer, must not be @c NULL.
  */
-inline size_t RingBuffer_getReadByteCapacity(const RingBuffer *rb) {
-    return (rb != NULL) ? rb->_len : 0;
+RINGBUFFER_INLINE size_t RingBuffer_getReadByteCapacity(const RingBuffer *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? rb->_len : 0;
 }
 
+/**
+ * Makes sure that a number of bytes can be written to the ring buffer.
+ *
+ * Grows a growable ring buffer as needed, and otherwise only checks the write
+ * capacity, so that a caller can write a unit of several pieces entirely or
+ * not at all.
+ *
+ * Returns @c false if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The ring buffer, must not be @c NULL.
+ * @param[in]       len The number of bytes.
+ *
+ * @return  Whether @p len bytes can now be written.
+ */
+RINGBUFFER_EXTERN bool RingBuffer_ensureWriteByteCapacity(RingBuffer *rb,
+                                                          size_t len);
+
 /**
  * Returns whether the ring buffer is empty.
  *
@@ -150,8 +290,8 @@ inline size_t RingBuffer_getReadByteCapacity(const RingBuffer *rb) {
  *
  * @param[in]   rb  The ring buffer, must not be @c NULL.
  */
-inline bool RingBuffer_isEmpty(const RingBuffer *rb) {
-    return (rb != NULL) ? (rb->_len == 0) : true;
+RINGBUFFER_INLINE bool RingBuffer_isEmpty(const RingBuffer *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? (rb->_len == 0) : true;
 }
 
 /**
@@ -164,8 +304,8 @@ inline bool RingBuffer_isEmpty(const RingBuffer *rb) {
  *
  * @param[in]   rb  The ring buffer, must not be @c NULL.
  */
-inline bool RingBuffer_isFull(const RingBuffer *rb) {
-    return (rb != NULL) ? (rb->_len == rb->_cap) : true;
+RINGBUFFER_INLINE bool RingBuffer_isFull(const RingBuffer *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? (rb->_len == rb->_cap) : true;
 }
 
 /**
@@ -175,8 +315,8 @@ inline bool RingBuffer_isFull(const RingBuffer *rb) {
  *
  * @param[in]   rb  The ring buffer, must not be @c NULL.
  */
-inline size_t RingBuffer_getWriteBytePosition(const RingBuffer *rb) {
-    return (rb != NULL) ? rb->_wpos : 0;
+RINGBUFFER_INLINE size_t RingBuffer_getWriteBytePosition(const RingBuffer *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? rb->_wpos : 0;
 }
 
 /**
@@ -186,8 +326,8 @@ inline size_t RingBuffer_getWriteBytePosition(const RingBuffer *rb) {
  *
  * @param[in]   rb  The ring buffer, must not be @c NULL.
  */
-inline size_t RingBuffer_getReadBytePosition(const RingBuffer *rb) {
-    return (rb != NULL) ? rb->_rpos : 0;
+RINGBUFFER_INLINE size_t RingBuffer_getReadBytePosition(const RingBuffer *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? rb->_rpos : 0;
 }
 
 /**
@@ -198,7 +338,7 @@ inline size_t RingBuffer_getReadBytePosition(const RingBuffer *rb) {
  *
  * @param[in]   rb  The ring buffer, must not be @c NULL.
  */
-extern size_t RingBuffer_getWriteByteSpan(const RingBuffer *rb);
+RINGBUFFER_EXTERN size_t RingBuffer_getWriteByteSpan(const RingBuffer *rb);
 
 /**
  * Returns the number of bytes than can be read contigously from the ring
@@ -209,7 +349,139 @@ extern size_t RingBuffer_getWriteByteSpan(const RingBuffer *rb);
  *
  * @param[in]   rb  The ring buffer, must not be @c NULL.
  */
-extern size_t RingBuffer_getReadByteSpan(const RingBuffer *rb);
+RINGBUFFER_EXTERN size_t RingBuffer_getReadByteSpan(const RingBuffer *rb);
+
+/**
+ * Moves the readable bytes of the ring buffer to the start of its data memory,
+ * so that all of them can be read contiguously.
+ *
+ * Rotates the bytes in place with block swaps through a small scratch area on
+ * the stack, without allocating memory. Afterwards, the read position is zero
+ * and RingBuffer_getReadByteSpan() equals RingBuffer_getReadByteCapacity().
+ *
+ * The readable bytes of a ring buffer with mirrored data memory are always
+ * contiguous, so this function leaves them in place.
+ *
+ * Returns zero if the @p rb parameter is @c NULL or a reservation is
+ * outstanding.
+ *
+ * @param[in,out]   rb  The ring buffer, must not be @c NULL.
+ *
+ * @return  The number of readable bytes.
+ */
+RINGBUFFER_EXTERN size_t RingBuffer_linearize(RingBuffer *rb);
+
+/**
+ * Enables or disables automatic linearization.
+ *
+ * While enabled, RingBuffer_writeBytes() and RingBuffer_reserveBytes() call
+ * RingBuffer_linearize() first when the bytes would otherwise wrap around the
+ * end of the data memory, so that the readable bytes are always contiguous and
+ * RingBuffer_getReadByteSpan() always equals RingBuffer_getReadByteCapacity().
+ * Writes that do not wrap cost nothing extra. It is initially disabled.
+ *
+ * Since such a write moves the readable bytes, it invalidates the regions
+ * returned by RingBuffer_peekSegments() and RingBuffer_peekSegmentsAt(), as
+ * RingBuffer_linearize() itself does.
+ *
+ * @param[in,out]   rb      The ring buffer, must not be @c NULL.
+ * @param[in]       enable  Whether to enable automatic linearization.
+ *
+ * @retval  false   The @p rb parameter is @c NULL.
+ * @retval  true    Success.
+ */
+RINGBUFFER_EXTERN bool RingBuffer_setAutoLinearize(RingBuffer *rb,
+                                                   bool enable);
+
+/**
+ * Sets the number of bytes from which RingBuffer_writeBytes() copies with
+ * non-temporal stores.
+ *
+ * Non-temporal stores bypass the caches, so that a large write that another
+ * core reads much later does not evict the writer's working set. Zero, the
+ * initial value, turns them off.
+ *
+ * @param[in,out]   rb  The ring buffer, must not be @c NULL.
+ * @param[in]       len The threshold in bytes, or zero.
+ *
+ * @retval  false   The @p rb parameter is @c NULL.
+ * @retval  true    Success.
+ */
+RINGBUFFER_INLINE bool RingBuffer_setStreamingThreshold(RingBuffer *rb,
+                                                        size_t len) {
+    if (RINGBUFFER_ISNULL(rb)) {
+        return false;
+    }
+    rb->_stmin = len;
+    return true;
+}
+
+/**
+ * Sets the number of bytes from which RingBuffer_readBytes(),
+ * RingBuffer_peekBytes() and RingBuffer_peekBytesAt() prefetch.
+ *
+ * Such a read prefetches the part of its bytes that wraps to the start of the
+ * data memory before copying the rest, and RingBuffer_readBytes() then
+ * prefetches the bytes that follow it. Zero, the initial value, turns
+ * prefetching off.
+ *
+ * @param[in,out]   rb  The ring buffer, must not be @c NULL.
+ * @param[in]       len The threshold in bytes, or zero.
+ *
+ * @retval  false   The @p rb parameter is @c NULL.
+ * @retval  true    Success.
+ */
+RINGBUFFER_INLINE bool RingBuffer_setPrefetchThreshold(RingBuffer *rb,
+                                                       size_t len) {
+    if (RINGBUFFER_ISNULL(rb)) {
+        return false;
+    }
+    rb->_pfmin = len;
+    return true;
+}
+
+/**
+ * Sets the function that releases the physical memory of idle data memory.
+ *
+ * The ring buffer keeps track of how far into its data memory it has written
+ * since the memory was last released, so that the pages beyond are known to be
+ * cold and are not released again. When a read or a discard empties the ring
+ * buffer and at least @p threshold bytes of its data memory may be resident,
+ * the ring buffer calls RingBuffer_reclaimMemory(), so that its resident set
+ * follows its occupancy. A zero threshold, the initial value, turns this off.
+ *
+ * Released pages read as zeros, or as their old contents, until written again.
+ *
+ * @param[in,out]   rb          The ring buffer, must not be @c NULL.
+ * @param[in]       reclaim     The function, or @c NULL for none.
+ * @param[in]       threshold   The threshold in bytes, or zero.
+ *
+ * @retval  false   The @p rb parameter is @c NULL.
+ * @retval  true    Success.
+ */
+RINGBUFFER_INLINE bool RingBuffer_setReclaimer(RingBuffer *rb,
+                                               RingBufferReclaimer reclaim,
+                                               size_t threshold) {
+    if (RINGBUFFER_ISNULL(rb)) {
+        return false;
+    }
+    rb->_reclaim = reclaim;
+    rb->_rcmin = threshold;
+    return true;
+}
+
+/**
+ * Releases the physical memory of the whole pages of the ring buffer's data
+ * memory that hold neither readable nor reserved bytes, with the function set
+ * by RingBuffer_setReclaimer().
+ *
+ * Returns zero if the @p rb parameter is @c NULL or no function is set.
+ *
+ * @param[in,out]   rb  The ring buffer, must not be @c NULL.
+ *
+ * @return  The number of bytes released.
+ */
+RINGBUFFER_EXTERN size_t RingBuffer_reclaimMemory(RingBuffer *rb);
 
 /**
  * Writes bytes to the ring buffer.
@@ -221,8 +493,62 @@ extern size_t RingBuffer_getReadByteSpan(const RingBuffer *rb);
  *
  * @return  The number of bytes copied or zero if a parameter is invalid.
  */
-extern size_t RingBuffer_writeBytes(RingBuffer *rb, const void *buf,
-                                    size_t len);
+RINGBUFFER_EXTERN size_t RingBuffer_writeBytes(RingBuffer *rb, const void *buf,
+                                               size_t len);
+
+/**
+ * Reserves bytes in the ring buffer for writing in place.
+ *
+ * Returns the one or two regions of data memory that follow the ring buffer's
+ * write position, so that the caller can fill them directly instead of copying
+ * from a buffer of its own. The second region has zero bytes unless the
+ * reservation wraps around the end of the data memory.
+ *
+ * The reserved bytes are not readable until published with
+ * RingBuffer_commitBytes(). A new reservation replaces the previous one, and no
+ * other write may happen while a reservation is outstanding.
+ *
+ * @param[in,out]   rb  The ring buffer, must not be @c NULL.
+ * @param[out]      seg The two reserved regions, must not be @c NULL.
+ * @param[in]       len The number of bytes to reserve.
+ *
+ * @return  The number of bytes reserved or zero if a parameter is invalid.
+ */
+RINGBUFFER_EXTERN size_t RingBuffer_reserveBytes(RingBuffer *rb,
+                                                 RingBufferSegment seg[2],
+                                                 size_t len);
+
+/**
+ * Publishes bytes reserved by RingBuffer_reserveBytes().
+ *
+ * Publishes the first @p len reserved bytes and drops the rest of the
+ * reservation.
+ *
+ * @param[in,out]   rb  The ring buffer, must not be @c NULL.
+ * @param[in]       len The number of reserved bytes to publish.
+ *
+ * @return  The number of bytes published or zero if a parameter is invalid.
+ */
+RINGBUFFER_EXTERN size_t RingBuffer_commitBytes(RingBuffer *rb, size_t len);
+
+/**
+ * Drops the bytes reserved by RingBuffer_reserveBytes() without publishing
+ * any of them.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The ring buffer, must not be @c NULL.
+ *
+ * @return  The number of bytes that were reserved.
+ */
+RINGBUFFER_INLINE size_t RingBuffer_abortBytes(RingBuffer *rb) {
+    if (RINGBUFFER_ISNULL(rb)) {
+        return 0;
+    }
+    size_t len = rb->_resv;
+    rb->_resv = 0;
+    return len;
+}
 
 /**
  * Discards bytes from the ring buffer.
@@ -232,7 +558,7 @@ extern size_t RingBuffer_writeBytes(RingBuffer *rb, const void *buf,
  *
  * @return  The number of bytes skipped or zero if a parameter is invalid.
  */
-extern size_t RingBuffer_discardBytes(RingBuffer *rb, size_t len);
+RINGBUFFER_EXTERN size_t RingBuffer_discardBytes(RingBuffer *rb, size_t len);
 
 /**
  * Reads bytes from the ring buffer.
@@ -244,7 +570,8 @@ extern size_t RingBuffer_discardBytes(RingBuffer *rb, size_t len);
  *
  * @return  The number of bytes copied or zero if a parameter is invalid.
  */
-extern size_t RingBuffer_readBytes(RingBuffer *rb, void *buf, size_t len);
+RINGBUFFER_EXTERN size_t RingBuffer_readBytes(RingBuffer *rb, void *buf,
+                                              size_t len);
 
 /**
  * Peeks bytes from the ring buffer.
@@ -258,7 +585,8 @@ extern size_t RingBuffer_readBytes(RingBuffer *rb, void *buf, size_t len);
  * @return  The number of bytes copied to the destination buffer or zero if a
  *          parameter is invalid.
  */
-extern size_t RingBuffer_peekBytes(const RingBuffer *rb, void *buf, size_t len);
+RINGBUFFER_EXTERN size_t RingBuffer_peekBytes(const RingBuffer *rb, void *buf,
+                                              size_t len);
 
 /**
  * Peeks bytes from the ring buffer at a byte offset from the ring buffer's read
@@ -273,11 +601,76 @@ extern size_t RingBuffer_peekBytes(const RingBuffer *rb, void *buf, size_t len);
  * @return  The number of bytes copied to the destination buffer or zero if a
  *          parameter is invalid.
  */
-extern size_t RingBuffer_peekBytesAt(const RingBuffer *rb, size_t pos,
-                                     void *buf, size_t len);
+RINGBUFFER_EXTERN size_t RingBuffer_peekBytesAt(const RingBuffer *rb,
+                                                size_t pos, void *buf,
+                                                size_t len);
+
+/**
+ * Peeks bytes in place in the ring buffer.
+ *
+ * This is equivalent to
+ * <code>RingBuffer_peekSegmentsAt(rb, 0, seg, len)</code>, and the regions
+ * stay valid for as long.
+ *
+ * @param[in]   rb  The ring buffer, must not be @c NULL.
+ * @param[out]  seg The two regions holding the bytes, must not be @c NULL.
+ * @param[in]   len The number of bytes to peek.
+ *
+ * @return  The number of bytes in the regions or zero if a parameter is
+ *          invalid.
+ */
+RINGBUFFER_EXTERN size_t RingBuffer_peekSegments(const RingBuffer *rb,
+                                                 RingBufferSegment seg[2],
+                                                 size_t len);
+
+/**
+ * Peeks bytes in place in the ring buffer at a byte offset from the ring
+ * buffer's read position.
+ *
+ * Returns the one or two regions of data memory holding the bytes, so that the
+ * caller can use them directly instead of copying them to a buffer of its own.
+ * The second region has zero bytes unless the bytes wrap around the end of the
+ * data memory. The regions stay valid until the bytes are consumed, except
+ * that RingBuffer_linearize() invalidates them, and so do
+ * RingBuffer_writeBytes() and RingBuffer_reserveBytes() on a growable ring
+ * buffer or with automatic linearization enabled, since they may move the
+ * bytes.
+ *
+ * @param[in]   rb  The ring buffer, must not be @c NULL.
+ * @param[in]   pos The byte offset from the ring buffer's read position at
+ *                  which to peek.
+ * @param[out]  seg The two regions holding the bytes, must not be @c NULL.
+ * @param[in]   len The number of bytes to peek.
+ *
+ * @return  The number of bytes in the regions or zero if a parameter is
+ *          invalid.
+ */
+RINGBUFFER_EXTERN size_t RingBuffer_peekSegmentsAt(const RingBuffer *rb,
+                                                   size_t pos,
+                                                   RingBufferSegment seg[2],
+                                                   size_t len);
+
+/**
+ * Consumes bytes peeked in place from the ring buffer.
+ *
+ * This is equivalent to <code>RingBuffer_discardBytes(rb, len)</code> and
+ * provided for expressive clarity and convenience.
+ *
+ * @param[in,out]   rb  The ring buffer, must not be @c NULL.
+ * @param[in]       len The number of bytes to consume.
+ *
+ * @return  The number of bytes consumed or zero if a parameter is invalid.
+ */
+RINGBUFFER_INLINE size_t RingBuffer_consumeBytes(RingBuffer *rb, size_t len) {
+    return RingBuffer_discardBytes(rb, len);
+}
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif // _RINGBUFFER_H
\ No newline at end of file
+#ifdef RINGBUFFER_HEADER_ONLY
+#include "../src/RingBuffer.c"
+#endif
+
+#endif // _RINGBUFFER_H
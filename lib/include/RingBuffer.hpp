@@ -0,0 +1,618 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+/**
+ * @file
+ * Declares typed C++ ring buffer templates.
+ *
+ * The templates mirror RingBuffer, RingBufferRo and RingBufferWo for elements
+ * of a type, with the capacity as a compile-time constant where the ring
+ * buffer owns its memory. They are header-only and call no library functions,
+ * so their hot paths inline fully.
+ *
+ * Requires C++17. Segments are @c std::span under C++20 and a minimal
+ * ringbuffer::Span otherwise.
+ *
+ * The member functions are not thread safe.
+ */
+
+#ifndef _RINGBUFFER_HPP
+#define _RINGBUFFER_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#if __has_include(<version>)
+#include <version>
+#endif
+#ifdef __cpp_lib_span
+#include <span>
+#endif
+
+namespace ringbuffer {
+
+#ifdef __cpp_lib_span
+template <typename T> using Span = std::span<T>;
+#else
+/**
+ * A contiguous sequence of elements, standing in for @c std::span before
+ * C++20.
+ */
+template <typename T> class Span {
+public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using pointer = T *;
+    using reference = T &;
+    using iterator = T *;
+
+    constexpr Span() noexcept = default;
+    constexpr Span(T *data, std::size_t size) noexcept
+        : _data(data), _size(size) {}
+    template <typename U, typename = std::enable_if_t<
+                              std::is_convertible_v<U (*)[], T (*)[]>>>
+    constexpr Span(const Span<U> &other) noexcept
+        : _data(other.data()), _size(other.size()) {}
+
+    constexpr T *data() const noexcept { return _data; }
+    constexpr std::size_t size() const noexcept { return _size; }
+    constexpr bool empty() const noexcept { return _size == 0; }
+    constexpr T *begin() const noexcept { return _data; }
+    constexpr T *end() const noexcept { return _data + _size; }
+    constexpr T &operator[](std::size_t i) const noexcept { return _data[i]; }
+
+private:
+    T *_data = nullptr;
+    std::size_t _size = 0;
+};
+#endif
+
+/**
+ * The one or two contiguous regions of a ring buffer holding a sequence of
+ * elements. The second region is empty unless the sequence wraps around the
+ * end of the ring buffer's memory.
+ */
+template <typename T> using SpanPair = std::pair<Span<T>, Span<T>>;
+
+/**
+ * A ring buffer of up to @p N elements of type @p T, held in place.
+ *
+ * Elements are constructed when pushed and destroyed when popped, so @p T
+ * need not be default constructible, and move-only types work.
+ *
+ * Like RingBuffer, positions run from zero to twice the capacity, so that a
+ * full ring buffer differs from an empty one. For a power-of-two capacity,
+ * the compiler folds the position arithmetic into masks.
+ */
+template <typename T, std::size_t N> class RingBuffer {
+    static_assert(N > 0, "RingBuffer capacity must not be zero");
+
+    template <bool Const> class Iterator;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    RingBuffer() noexcept = default;
+
+    RingBuffer(const RingBuffer &other) {
+        for (const T &elem : other) {
+            push(elem);
+        }
+    }
+
+    RingBuffer(RingBuffer &&other) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+        for (T &elem : other) {
+            push(std::move(elem));
+        }
+        other.clear();
+    }
+
+    RingBuffer &operator=(const RingBuffer &other) {
+        if (this != &other) {
+            clear();
+            for (const T &elem : other) {
+                push(elem);
+            }
+        }
+        return *this;
+    }
+
+    RingBuffer &operator=(RingBuffer &&other) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            clear();
+            for (T &elem : other) {
+                push(std::move(elem));
+            }
+            other.clear();
+        }
+        return *this;
+    }
+
+    ~RingBuffer() { clear(); }
+
+    /**
+     * Returns the maximum number of elements.
+     */
+    static constexpr std::size_t capacity() noexcept { return N; }
+
+    /**
+     * Returns the number of elements held.
+     */
+    std::size_t size() const noexcept { return wrap(_wpos + 2 * N - _rpos); }
+
+    /**
+     * Returns whether the ring buffer holds no elements.
+     */
+    bool empty() const noexcept { return _wpos == _rpos; }
+
+    /**
+     * Returns whether the ring buffer holds @p N elements.
+     */
+    bool full() const noexcept { return size() == N; }
+
+    /**
+     * Constructs an element in place after the newest element.
+     *
+     * @return  The element, or @c nullptr if the ring buffer is full.
+     */
+    template <typename... Args> T *emplace(Args &&...args) {
+        if (full()) {
+            return nullptr;
+        }
+        T *elem = ::new (static_cast<void *>(slot(_wpos)))
+            T(std::forward<Args>(args)...);
+        _wpos = wrap(_wpos + 1);
+        return elem;
+    }
+
+    /**
+     * Copies an element after the newest element.
+     *
+     * @return  @c false if the ring buffer is full.
+     */
+    bool push(const T &elem) { return emplace(elem) != nullptr; }
+
+    /**
+     * Moves an element after the newest element.
+     *
+     * @return  @c false if the ring buffer is full.
+     */
+    bool push(T &&elem) { return emplace(std::move(elem)) != nullptr; }
+
+    /**
+     * Destroys the oldest element.
+     *
+     * @return  @c false if the ring buffer is empty.
+     */
+    bool pop() noexcept {
+        if (empty()) {
+            return false;
+        }
+        std::destroy_at(element(_rpos));
+        _rpos = wrap(_rpos + 1);
+        return true;
+    }
+
+    /**
+     * Moves the oldest element to @p elem and destroys it.
+     *
+     * @return  @c false if the ring buffer is empty.
+     */
+    bool pop(T &elem) {
+        if (empty()) {
+            return false;
+        }
+        elem = std::move(*element(_rpos));
+        return pop();
+    }
+
+    /**
+     * Destroys the oldest elements.
+     *
+     * @return  The number of elements destroyed.
+     */
+    std::size_t consume(std::size_t count) noexcept {
+        std::size_t len = size();
+        if (count > len) {
+            count = len;
+        }
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            _rpos = wrap(_rpos + count);
+        } else {
+            for (std::size_t i = 0; i < count; ++i) {
+                pop();
+            }
+        }
+        return count;
+    }
+
+    /**
+     * Destroys all elements.
+     */
+    void clear() noexcept {
+        consume(size());
+        _wpos = 0;
+        _rpos = 0;
+    }
+
+    /**
+     * Returns the oldest element, which must exist.
+     */
+    T &front() noexcept { return *element(_rpos); }
+    const T &front() const noexcept { return *element(_rpos); }
+
+    /**
+     * Returns the newest element, which must exist.
+     */
+    T &back() noexcept { return *element(wrap(_wpos + 2 * N - 1)); }
+    const T &back() const noexcept {
+        return *element(wrap(_wpos + 2 * N - 1));
+    }
+
+    /**
+     * Returns the element @p i places after the oldest element, which must
+     * exist.
+     */
+    T &operator[](std::size_t i) noexcept { return *element(wrap(_rpos + i)); }
+    const T &operator[](std::size_t i) const noexcept {
+        return *element(wrap(_rpos + i));
+    }
+
+    iterator begin() noexcept { return iterator(this, 0); }
+    iterator end() noexcept { return iterator(this, size()); }
+    const_iterator begin() const noexcept { return const_iterator(this, 0); }
+    const_iterator end() const noexcept {
+        return const_iterator(this, size());
+    }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /**
+     * Returns the regions holding the elements, oldest first.
+     */
+    SpanPair<T> readSegments() noexcept { return segments<T>(_rpos, size()); }
+    SpanPair<const T> readSegments() const noexcept {
+        return segments<const T>(_rpos, size());
+    }
+
+    /**
+     * Returns the regions of free memory after the newest element, for the
+     * caller to fill and then commit().
+     *
+     * Only for trivially copyable element types, since the memory holds no
+     * constructed elements.
+     */
+    SpanPair<T> writeSegments() noexcept {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "writeSegments() needs a trivially copyable type");
+        return segments<T>(_wpos, N - size());
+    }
+
+    /**
+     * Appends @p count elements written to the regions from writeSegments().
+     *
+     * @return  The number of elements appended.
+     */
+    std::size_t commit(std::size_t count) noexcept {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "commit() needs a trivially copyable type");
+        std::size_t wcap = N - size();
+        if (count > wcap) {
+            count = wcap;
+        }
+        _wpos = wrap(_wpos + count);
+        return count;
+    }
+
+private:
+    // Reduces a position below four times the capacity to below twice it.
+    static constexpr std::size_t wrap(std::size_t pos) noexcept {
+        if constexpr ((N & (N - 1)) == 0) {
+            return pos & (2 * N - 1);
+        } else {
+            return (pos >= 2 * N) ? (pos - 2 * N) : pos;
+        }
+    }
+
+    // Returns the element index of a position.
+    static constexpr std::size_t index(std::size_t pos) noexcept {
+        if constexpr ((N & (N - 1)) == 0) {
+            return pos & (N - 1);
+        } else {
+            return (pos >= N) ? (pos - N) : pos;
+        }
+    }
+
+    T *slot(std::size_t pos) noexcept {
+        return reinterpret_cast<T *>(_storage) + index(pos);
+    }
+    const T *slot(std::size_t pos) const noexcept {
+        return reinterpret_cast<const T *>(_storage) + index(pos);
+    }
+
+    T *element(std::size_t pos) noexcept { return std::launder(slot(pos)); }
+    const T *element(std::size_t pos) const noexcept {
+        return std::launder(slot(pos));
+    }
+
+    template <typename U>
+    SpanPair<U> segments(std::size_t pos, std::size_t len) const noexcept {
+        U *data = const_cast<U *>(slot(pos));
+        U *base = const_cast<U *>(slot(0));
+        std::size_t first = N - index(pos);
+        if (len <= first) {
+            return {Span<U>(data, len), Span<U>(base, 0)};
+        }
+        return {Span<U>(data, first), Span<U>(base, len - first)};
+    }
+
+    alignas(T) unsigned char _storage[N * sizeof(T)];
+    std::size_t _wpos = 0;
+    std::size_t _rpos = 0;
+};
+
+/**
+ * A random-access iterator over a RingBuffer's elements, oldest first, that
+ * follows the elements around the end of the ring buffer's memory.
+ */
+template <typename T, std::size_t N>
+template <bool Const>
+class RingBuffer<T, N>::Iterator {
+    using Ring = std::conditional_t<Const, const RingBuffer, RingBuffer>;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+
+    Iterator() noexcept = default;
+    Iterator(Ring *rb, std::size_t i) noexcept : _rb(rb), _i(i) {}
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    Iterator(const Iterator<false> &other) noexcept
+        : _rb(other._rb), _i(other._i) {}
+
+    reference operator*() const noexcept { return (*_rb)[_i]; }
+    pointer operator->() const noexcept { return &(*_rb)[_i]; }
+    reference operator[](difference_type n) const noexcept {
+        return (*_rb)[_i + n];
+    }
+
+    Iterator &operator++() noexcept {
+        ++_i;
+        return *this;
+    }
+    Iterator operator++(int) noexcept {
+        Iterator it = *this;
+        ++_i;
+        return it;
+    }
+    Iterator &operator--() noexcept {
+        --_i;
+        return *this;
+    }
+    Iterator operator--(int) noexcept {
+        Iterator it = *this;
+        --_i;
+        return it;
+    }
+    Iterator &operator+=(difference_type n) noexcept {
+        _i += n;
+        return *this;
+    }
+    Iterator &operator-=(difference_type n) noexcept {
+        _i -= n;
+        return *this;
+    }
+    friend Iterator operator+(Iterator it, difference_type n) noexcept {
+        return it += n;
+    }
+    friend Iterator operator+(difference_type n, Iterator it) noexcept {
+        return it += n;
+    }
+    friend Iterator operator-(Iterator it, difference_type n) noexcept {
+        return it -= n;
+    }
+    friend difference_type operator-(const Iterator &a,
+                                     const Iterator &b) noexcept {
+        return static_cast<difference_type>(a._i) -
+               static_cast<difference_type>(b._i);
+    }
+
+    friend bool operator==(const Iterator &a, const Iterator &b) noexcept {
+        return a._i == b._i;
+    }
+    friend bool operator!=(const Iterator &a, const Iterator &b) noexcept {
+        return a._i != b._i;
+    }
+    friend bool operator<(const Iterator &a, const Iterator &b) noexcept {
+        return a._i < b._i;
+    }
+    friend bool operator>(const Iterator &a, const Iterator &b) noexcept {
+        return a._i > b._i;
+    }
+    friend bool operator<=(const Iterator &a, const Iterator &b) noexcept {
+        return a._i <= b._i;
+    }
+    friend bool operator>=(const Iterator &a, const Iterator &b) noexcept {
+        return a._i >= b._i;
+    }
+
+private:
+    friend class Iterator<!Const>;
+
+    Ring *_rb = nullptr;
+    std::size_t _i = 0;
+};
+
+/**
+ * A read-only ring buffer of elements of type @p T in external memory.
+ *
+ * Like RingBufferRo, the data must be written by external code, and the ring
+ * buffer acts as if it were always full.
+ */
+template <typename T> class RingBufferRo {
+public:
+    /**
+     * Initializes the ring buffer with external memory, which must not be
+     * empty.
+     */
+    explicit RingBufferRo(Span<const T> data) noexcept : _data(data) {}
+
+    /**
+     * Returns the number of elements in the external memory.
+     */
+    std::size_t capacity() const noexcept { return _data.size(); }
+
+    /**
+     * Returns the read position.
+     */
+    std::size_t readPosition() const noexcept { return _rpos; }
+
+    /**
+     * Returns the regions holding the next @p len elements, which must not be
+     * more than the capacity.
+     */
+    SpanPair<const T> readSegments(std::size_t len) const noexcept {
+        std::size_t first = _data.size() - _rpos;
+        if (len <= first) {
+            return {Span<const T>(_data.data() + _rpos, len),
+                    Span<const T>(_data.data(), 0)};
+        }
+        return {Span<const T>(_data.data() + _rpos, first),
+                Span<const T>(_data.data(), len - first)};
+    }
+
+    /**
+     * Copies the next elements to @p buf without consuming them.
+     */
+    void peek(Span<T> buf) const {
+        std::size_t rpos = _rpos;
+        for (T &elem : buf) {
+            elem = _data[rpos];
+            if (++rpos == _data.size()) {
+                rpos = 0;
+            }
+        }
+    }
+
+    /**
+     * Copies the next elements to @p buf and consumes them.
+     */
+    void read(Span<T> buf) {
+        peek(buf);
+        discard(buf.size());
+    }
+
+    /**
+     * Skips @p len elements.
+     */
+    void discard(std::size_t len) noexcept {
+        std::size_t cap = _data.size();
+        std::size_t rpos = _rpos + ((len < cap) ? len : (len % cap));
+        _rpos = (rpos >= cap) ? (rpos - cap) : rpos;
+    }
+
+    /**
+     * Resets the read position to zero.
+     */
+    void reset() noexcept { _rpos = 0; }
+
+private:
+    Span<const T> _data;
+    std::size_t _rpos = 0;
+};
+
+/**
+ * A write-only ring buffer of up to @p N elements of type @p T, held in place.
+ *
+ * Like RingBufferWo, writing overwrites the oldest element unconditionally, so
+ * the elements are default constructed up front and assigned when pushed.
+ */
+template <typename T, std::size_t N> class RingBufferWo {
+    static_assert(N > 0, "RingBufferWo capacity must not be zero");
+
+public:
+    /**
+     * Returns the number of elements held.
+     */
+    static constexpr std::size_t capacity() noexcept { return N; }
+
+    /**
+     * Returns the write position, that is, the index of the oldest element.
+     */
+    std::size_t writePosition() const noexcept { return _wpos; }
+
+    /**
+     * Returns the elements in memory order.
+     */
+    Span<T> data() noexcept { return Span<T>(_data, N); }
+    Span<const T> data() const noexcept { return Span<const T>(_data, N); }
+
+    /**
+     * Assigns an element at the write position, overwriting the oldest
+     * element.
+     */
+    template <typename U> void push(U &&elem) {
+        _data[_wpos] = std::forward<U>(elem);
+        _wpos = (_wpos + 1 == N) ? 0 : (_wpos + 1);
+    }
+
+    /**
+     * Returns the regions holding the elements, oldest first.
+     */
+    SpanPair<const T> readSegments() const noexcept {
+        return {Span<const T>(_data + _wpos, N - _wpos),
+                Span<const T>(_data, _wpos)};
+    }
+
+    /**
+     * Resets the write position to zero.
+     */
+    void reset() noexcept { _wpos = 0; }
+
+private:
+    T _data[N] = {};
+    std::size_t _wpos = 0;
+};
+
+} // namespace ringbuffer
+
+#endif // _RINGBUFFER_HPP
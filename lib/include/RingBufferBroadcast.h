@@ -0,0 +1,252 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Declares RingBufferBroadcast and associated functions.
+ *
+ * The functions are thread safe for one producer thread and one thread per
+ * consumer. Functions documented as producer functions must only be called by
+ * the producer thread, and functions documented as consumer functions must only
+ * be called by the consumer's thread. The other functions are not thread safe.
+ */
+
+#ifndef _RINGBUFFERBROADCAST_H
+#define _RINGBUFFERBROADCAST_H
+
+#include "RingBuffer.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * The cache line size in bytes assumed for separating the producer's and each
+ * consumer's data.
+ */
+#ifndef RINGBUFFERBROADCAST_CACHE_LINE_SIZE
+#define RINGBUFFERBROADCAST_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * A consumer's read index in a broadcast ring buffer.
+ *
+ * Each consumer's read index lives on its own cache line together with the
+ * consumer's cached copy of the write index.
+ */
+typedef struct {
+    _Alignas(RINGBUFFERBROADCAST_CACHE_LINE_SIZE) atomic_size_t _rpos;
+    size_t _wposCache;
+} RingBufferBroadcastReader;
+
+/**
+ * A single-producer/multi-consumer lock-free broadcast ring buffer.
+ *
+ * Every consumer reads every byte written by the producer, at its own pace,
+ * through its own read index, so the producer writes each byte once however
+ * many consumers there are. The room left for the producer is bounded by the
+ * slowest consumer. The producer caches which consumer that is, and only loads
+ * the consumers' read indices again when its cached copy says that the ring
+ * buffer is full.
+ *
+ * The indices run from zero to twice the capacity, as in RingBufferSpsc.
+ *
+ * When allocating a ring buffer dynamically, use memory aligned to
+ * @c RINGBUFFERBROADCAST_CACHE_LINE_SIZE.
+ */
+typedef struct {
+    uint8_t *_data;
+    size_t _cap;
+    RingBufferBroadcastReader *_readers;
+    size_t _count;
+    _Alignas(RINGBUFFERBROADCAST_CACHE_LINE_SIZE) atomic_size_t _wpos;
+    size_t _rposCache;
+} RingBufferBroadcast;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Initializes the broadcast ring buffer.
+ *
+ * @param[out]      rb      The broadcast ring buffer, must not be @c NULL.
+ * @param[in,out]   data    The data memory, or external memory for storing the
+ *                          data, must not be @c NULL.
+ * @param[in]       cap     The data memory capacity in bytes, must not be zero
+ *                          or greater than <code>SIZE_MAX / 2</code>.
+ * @param[out]      readers The consumers' read indices, or external memory for
+ *                          storing them, must not be @c NULL.
+ * @param[in]       count   The number of consumers, must not be zero.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+extern bool RingBufferBroadcast_initialize(RingBufferBroadcast *rb,
+                                           void *data, size_t cap,
+                                           RingBufferBroadcastReader *readers,
+                                           size_t count);
+
+/**
+ * Returns the broadcast ring buffer's data memory pointer.
+ *
+ * Returns @c NULL if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The broadcast ring buffer, must not be @c NULL.
+ */
+inline void *RingBufferBroadcast_getDataPointer(const RingBufferBroadcast *rb) {
+    return (rb != NULL) ? rb->_data : NULL;
+}
+
+/**
+ * Returns the broadcast ring buffer's data memory capacity in bytes.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The broadcast ring buffer, must not be @c NULL.
+ */
+inline size_t
+RingBufferBroadcast_getByteCapacity(const RingBufferBroadcast *rb) {
+    return (rb != NULL) ? rb->_cap : 0;
+}
+
+/**
+ * Returns the broadcast ring buffer's number of consumers.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The broadcast ring buffer, must not be @c NULL.
+ */
+inline size_t
+RingBufferBroadcast_getReaderCount(const RingBufferBroadcast *rb) {
+    return (rb != NULL) ? rb->_count : 0;
+}
+
+/**
+ * Returns the number of bytes that can be written to the broadcast ring buffer
+ * before the ring buffer becomes full for the slowest consumer.
+ *
+ * This is a producer function.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The broadcast ring buffer, must not be @c NULL.
+ */
+extern size_t RingBufferBroadcast_getWriteByteCapacity(RingBufferBroadcast *rb);
+
+/**
+ * Writes bytes to the broadcast ring buffer for all consumers.
+ *
+ * This is a producer function.
+ *
+ * @param[in,out]   rb  The broadcast ring buffer, must not be @c NULL.
+ * @param[in]       buf The source memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to copy from the source memory to
+ *                      the ring buffer.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid.
+ */
+extern size_t RingBufferBroadcast_writeBytes(RingBufferBroadcast *rb,
+                                             const void *buf, size_t len);
+
+/**
+ * Returns the number of bytes that a consumer can read from the broadcast ring
+ * buffer before the ring buffer becomes empty for the consumer.
+ *
+ * This is a consumer function.
+ *
+ * Returns zero if a parameter is invalid.
+ *
+ * @param[in,out]   rb      The broadcast ring buffer, must not be @c NULL.
+ * @param[in]       reader  The consumer's index, must be less than the number
+ *                          of consumers.
+ */
+extern size_t RingBufferBroadcast_getReadByteCapacity(RingBufferBroadcast *rb,
+                                                      size_t reader);
+
+/**
+ * Peeks bytes in place in the broadcast ring buffer for a consumer.
+ *
+ * Returns the one or two regions of data memory holding the bytes, so that the
+ * consumer can use them directly instead of copying them to a buffer of its
+ * own. The second region has zero bytes unless the bytes wrap around the end
+ * of the data memory. The regions stay valid until the consumer consumes the
+ * bytes.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb      The broadcast ring buffer, must not be @c NULL.
+ * @param[in]       reader  The consumer's index, must be less than the number
+ *                          of consumers.
+ * @param[out]      seg     The regions holding the bytes, must not be
+ *                          @c NULL.
+ * @param[in]       len     The number of bytes to peek.
+ *
+ * @return  The number of bytes in the regions or zero if a parameter is
+ *          invalid.
+ */
+extern size_t RingBufferBroadcast_peekSegments(RingBufferBroadcast *rb,
+                                               size_t reader,
+                                               RingBufferSegment seg[2],
+                                               size_t len);
+
+/**
+ * Consumes bytes from the broadcast ring buffer for a consumer, typically
+ * after peeking them with RingBufferBroadcast_peekSegments().
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb      The broadcast ring buffer, must not be @c NULL.
+ * @param[in]       reader  The consumer's index, must be less than the number
+ *                          of consumers.
+ * @param[in]       len     The number of bytes to consume.
+ *
+ * @return  The number of bytes consumed or zero if a parameter is invalid.
+ */
+extern size_t RingBufferBroadcast_consumeBytes(RingBufferBroadcast *rb,
+                                               size_t reader, size_t len);
+
+/**
+ * Reads bytes from the broadcast ring buffer for a consumer.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb      The broadcast ring buffer, must not be @c NULL.
+ * @param[in]       reader  The consumer's index, must be less than the number
+ *                          of consumers.
+ * @param[out]      buf     The destination memory, must not be @c NULL.
+ * @param[in]       len     The number of bytes to copy from the ring buffer to
+ *                          the destination memory.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid.
+ */
+extern size_t RingBufferBroadcast_readBytes(RingBufferBroadcast *rb,
+                                            size_t reader, void *buf,
+                                            size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _RINGBUFFERBROADCAST_H
@@ -0,0 +1,60 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Defines the build configuration macros shared by the ring buffer headers.
+ *
+ * Define @c RINGBUFFER_HEADER_ONLY to make RingBuffer, RingBufferRo,
+ * RingBufferWo, RingBufferStream, RingBufferMsg and RingBufferIndex
+ * header-only: their headers then include the implementations and define all
+ * of their functions @c static @c inline, so that every call can inline.
+ *
+ * Define @c RINGBUFFER_UNCHECKED to remove the @c NULL checks from the
+ * RingBuffer, RingBufferRo and RingBufferWo functions, for release builds
+ * whose callers never pass @c NULL. The functions then do not handle a
+ * @c NULL pointer as documented.
+ *
+ * Either macro must be defined the same way for the library and for all of
+ * its callers.
+ */
+
+#ifndef _RINGBUFFERCONFIG_H
+#define _RINGBUFFERCONFIG_H
+
+#ifdef RINGBUFFER_HEADER_ONLY
+#define RINGBUFFER_INLINE static inline
+#define RINGBUFFER_EXTERN static inline
+#else
+#define RINGBUFFER_INLINE inline
+#define RINGBUFFER_EXTERN extern
+#endif
+
+#ifdef RINGBUFFER_UNCHECKED
+#define RINGBUFFER_ISNULL(ptr) 0
+#else
+#define RINGBUFFER_ISNULL(ptr) ((ptr) == NULL)
+#endif
+
+#endif // _RINGBUFFERCONFIG_H
@@ -0,0 +1,168 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Defines RINGBUFFER_DEFINE(), which generates typed ring buffers.
+ *
+ * The generated functions are not thread safe.
+ */
+
+#ifndef _RINGBUFFERDEFINE_H
+#define _RINGBUFFERDEFINE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+#define RINGBUFFER_STATIC_ASSERT static_assert
+#else
+#define RINGBUFFER_STATIC_ASSERT _Static_assert
+#endif
+
+// Positions run from zero to twice the capacity, so that a full ring buffer
+// differs from an empty one. For a power-of-two capacity, the compiler folds
+// these into masks.
+
+// Reduces a position below four times the capacity to below twice it.
+#define RINGBUFFERDEFINE_WRAP(pos, capacity)                                   \
+    ((((capacity) & ((capacity) - 1)) == 0)                                    \
+         ? ((pos) & (2 * (size_t)(capacity) - 1))                              \
+         : (((pos) >= 2 * (size_t)(capacity))                                  \
+                ? ((pos) - 2 * (size_t)(capacity))                             \
+                : (pos)))
+
+// Returns the element index of a position.
+#define RINGBUFFERDEFINE_INDEX(pos, capacity)                                  \
+    ((((capacity) & ((capacity) - 1)) == 0)                                    \
+         ? ((pos) & ((size_t)(capacity) - 1))                                  \
+         : (((pos) >= (size_t)(capacity)) ? ((pos) - (size_t)(capacity))       \
+                                          : (pos)))
+
+/**
+ * Generates a ring buffer of elements of a type with a capacity fixed at
+ * compile time.
+ *
+ * Defines the struct @p name, holding the elements in place, and the following
+ * static inline functions, where @c rb must not be @c NULL:
+ *
+ * - <code>bool name_initialize(name *rb)</code> empties the ring buffer and
+ *   returns @c false if @c rb is @c NULL.
+ * - <code>size_t name_getCapacity(const name *rb)</code> returns @p capacity.
+ * - <code>size_t name_getCount(const name *rb)</code> returns the number of
+ *   elements held.
+ * - <code>bool name_isEmpty(const name *rb)</code> and
+ *   <code>bool name_isFull(const name *rb)</code>.
+ * - <code>bool name_push(name *rb, type elem)</code> appends an element and
+ *   returns @c false if the ring buffer is full.
+ * - <code>bool name_pop(name *rb, type *elem)</code> removes the oldest
+ *   element, copying it to @c elem unless @c elem is @c NULL, and returns
+ *   @c false if the ring buffer is empty.
+ * - <code>type *name_peek(name *rb)</code> returns the oldest element in place,
+ *   or @c NULL if the ring buffer is empty.
+ * - <code>type *name_at(name *rb, size_t i)</code> returns the element @c i
+ *   places after the oldest element in place, or @c NULL if there is none.
+ *
+ * Because the capacity is a compile-time constant, the compiler folds the
+ * position arithmetic, and because the ring buffer holds whole elements, an
+ * element never straddles the end of the data memory.
+ *
+ * @param   name        The name of the struct, also used as the prefix of the
+ *                      functions.
+ * @param   type        The element type.
+ * @param   capacity    The maximum number of elements, a positive integer
+ *                      constant expression.
+ */
+#define RINGBUFFER_DEFINE(name, type, capacity)                                \
+typedef struct {                                                               \
+    type _data[capacity];                                                      \
+    size_t _wpos;                                                              \
+    size_t _rpos;                                                              \
+} name;                                                                        \
+                                                                               \
+RINGBUFFER_STATIC_ASSERT((capacity) > 0, #name " capacity must not be zero");  \
+                                                                               \
+static inline bool name##_initialize(name *rb) {                               \
+    if (rb == NULL) {                                                          \
+        return false;                                                          \
+    }                                                                          \
+    rb->_wpos = 0;                                                             \
+    rb->_rpos = 0;                                                             \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline size_t name##_getCapacity(const name *rb) {                      \
+    return (rb != NULL) ? (size_t)(capacity) : 0;                              \
+}                                                                              \
+                                                                               \
+static inline size_t name##_getCount(const name *rb) {                         \
+    return (rb != NULL) ? RINGBUFFERDEFINE_WRAP(rb->_wpos +                    \
+                                                    2 * (size_t)(capacity) -   \
+                                                    rb->_rpos,                 \
+                                                capacity)                      \
+                        : 0;                                                   \
+}                                                                              \
+                                                                               \
+static inline bool name##_isEmpty(const name *rb) {                            \
+    return (rb != NULL) ? (rb->_wpos == rb->_rpos) : true;                     \
+}                                                                              \
+                                                                               \
+static inline bool name##_isFull(const name *rb) {                             \
+    return (rb != NULL) ? (name##_getCount(rb) == (size_t)(capacity)) : true;  \
+}                                                                              \
+                                                                               \
+static inline bool name##_push(name *rb, type elem) {                          \
+    if ((rb == NULL) || name##_isFull(rb)) {                                   \
+        return false;                                                          \
+    }                                                                          \
+    rb->_data[RINGBUFFERDEFINE_INDEX(rb->_wpos, capacity)] = elem;             \
+    rb->_wpos = RINGBUFFERDEFINE_WRAP(rb->_wpos + 1, capacity);                \
+    return true;                                                               \
+}                                                                              \
+                                                                               \
+static inline type *name##_at(name *rb, size_t i) {                            \
+    if ((rb == NULL) || (i >= name##_getCount(rb))) {                          \
+        return NULL;                                                           \
+    }                                                                          \
+    size_t pos = RINGBUFFERDEFINE_WRAP(rb->_rpos + i, capacity);               \
+    return &rb->_data[RINGBUFFERDEFINE_INDEX(pos, capacity)];                  \
+}                                                                              \
+                                                                               \
+static inline type *name##_peek(name *rb) {                                    \
+    return name##_at(rb, 0);                                                   \
+}                                                                              \
+                                                                               \
+static inline bool name##_pop(name *rb, type *elem) {                          \
+    type *oldest = name##_peek(rb);                                            \
+    if (oldest == NULL) {                                                      \
+        return false;                                                          \
+    }                                                                          \
+    if (elem != NULL) {                                                        \
+        *elem = *oldest;                                                       \
+    }                                                                          \
+    rb->_rpos = RINGBUFFERDEFINE_WRAP(rb->_rpos + 1, capacity);                \
+    return true;                                                               \
+}
+
+#endif // _RINGBUFFERDEFINE_H
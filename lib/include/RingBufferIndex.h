@@ -0,0 +1,209 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Declares RingBufferIndex and associated functions.
+ *
+ * The functions are not thread safe.
+ */
+
+#ifndef _RINGBUFFERINDEX_H
+#define _RINGBUFFERINDEX_H
+
+#include "RingBuffer.h"
+#include "RingBufferConfig.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A record index for a ring buffer.
+ *
+ * Keeps the start offsets of the variable-length records in a companion
+ * RingBuffer in a ring of its own, in external memory provided by the caller,
+ * so that seeking to a record, counting the records and discarding records
+ * take constant time instead of a walk over the records.
+ *
+ * Records must be appended to and discarded from the companion ring buffer
+ * through the index only. Bytes already in the companion ring buffer when the
+ * index is initialized belong to no record and are discarded with the first
+ * record.
+ */
+typedef struct {
+    RingBuffer *_rb;
+    uint64_t *_offs;
+    size_t _cap;
+    size_t _head;
+    size_t _count;
+    uint64_t _base;
+    uint64_t _end;
+} RingBufferIndex;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Initializes the record index.
+ *
+ * @param[out]      ri      The record index, must not be @c NULL.
+ * @param[in,out]   rb      The companion ring buffer, must not be @c NULL.
+ * @param[in,out]   offs    The offset memory, or external memory for storing
+ *                          the record offsets, must not be @c NULL.
+ * @param[in]       cap     The maximum number of records, that is, the number
+ *                          of offsets in the offset memory, must not be zero.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+RINGBUFFER_INLINE bool RingBufferIndex_initialize(RingBufferIndex *ri,
+                                                  RingBuffer *rb,
+                                                  uint64_t *offs, size_t cap) {
+    if ((ri == NULL) || (rb == NULL) || (offs == NULL) || (cap == 0)) {
+        return false;
+    }
+    ri->_rb = rb;
+    ri->_offs = offs;
+    ri->_cap = cap;
+    ri->_head = 0;
+    ri->_count = 0;
+    ri->_base = 0;
+    ri->_end = RingBuffer_getReadByteCapacity(rb);
+    return true;
+}
+
+/**
+ * Returns the maximum number of records in the record index.
+ *
+ * Returns zero if the @p ri parameter is @c NULL.
+ *
+ * @param[in]   ri  The record index, must not be @c NULL.
+ */
+RINGBUFFER_INLINE size_t
+RingBufferIndex_getRecordCapacity(const RingBufferIndex *ri) {
+    return (ri != NULL) ? ri->_cap : 0;
+}
+
+/**
+ * Returns the number of records in the record index.
+ *
+ * Returns zero if the @p ri parameter is @c NULL.
+ *
+ * @param[in]   ri  The record index, must not be @c NULL.
+ */
+RINGBUFFER_INLINE size_t
+RingBufferIndex_getRecordCount(const RingBufferIndex *ri) {
+    return (ri != NULL) ? ri->_count : 0;
+}
+
+/**
+ * Appends a record to the companion ring buffer and the record index.
+ *
+ * Writes the whole record, or nothing if the record or its offset does not
+ * fit. A growable companion ring buffer grows to fit the record, see
+ * RingBuffer_ensureWriteByteCapacity().
+ *
+ * @param[in,out]   ri  The record index, must not be @c NULL.
+ * @param[in]       buf The record, must not be @c NULL.
+ * @param[in]       len The number of bytes in the record, which may be zero.
+ *
+ * @retval  false   A parameter is invalid or the record does not fit.
+ * @retval  true    Success.
+ */
+RINGBUFFER_EXTERN bool RingBufferIndex_appendRecord(RingBufferIndex *ri,
+                                                    const void *buf,
+                                                    size_t len);
+
+/**
+ * Seeks a record in the companion ring buffer.
+ *
+ * @param[in]   ri  The record index, must not be @c NULL.
+ * @param[in]   k   The record's index, counting from zero for the oldest
+ *                  record.
+ * @param[out]  pos The record's byte offset from the companion ring buffer's
+ *                  read position, for RingBuffer_peekBytesAt() and
+ *                  RingBuffer_peekSegmentsAt(), must not be @c NULL.
+ * @param[out]  len The number of bytes in the record, may be @c NULL.
+ *
+ * @retval  false   A parameter is invalid or there is no such record.
+ * @retval  true    Success.
+ */
+RINGBUFFER_EXTERN bool RingBufferIndex_seekRecord(const RingBufferIndex *ri,
+                                                  size_t k, size_t *pos,
+                                                  size_t *len);
+
+/**
+ * Returns the number of bytes in a record.
+ *
+ * Returns zero if a parameter is invalid or there is no such record.
+ *
+ * @param[in]   ri  The record index, must not be @c NULL.
+ * @param[in]   k   The record's index, counting from zero for the oldest
+ *                  record.
+ */
+RINGBUFFER_EXTERN size_t
+RingBufferIndex_getRecordLength(const RingBufferIndex *ri, size_t k);
+
+/**
+ * Peeks a record in place in the companion ring buffer.
+ *
+ * See RingBuffer_peekSegmentsAt() for the regions returned. The regions stay
+ * valid until the record is discarded, except that appending a record to a
+ * growable companion ring buffer, or to one with automatic linearization
+ * enabled, invalidates them, since it may move the bytes.
+ *
+ * @param[in]   ri  The record index, must not be @c NULL.
+ * @param[in]   k   The record's index, counting from zero for the oldest
+ *                  record.
+ * @param[out]  seg The regions holding the record, must not be @c NULL.
+ *
+ * @retval  false   A parameter is invalid or there is no such record.
+ * @retval  true    Success.
+ */
+RINGBUFFER_EXTERN bool RingBufferIndex_peekRecord(const RingBufferIndex *ri,
+                                                  size_t k,
+                                                  RingBufferSegment seg[2]);
+
+/**
+ * Discards the oldest records from the companion ring buffer and the record
+ * index.
+ *
+ * @param[in,out]   ri  The record index, must not be @c NULL.
+ * @param[in]       k   The number of records to discard.
+ *
+ * @return  The number of records discarded or zero if a parameter is invalid.
+ */
+RINGBUFFER_EXTERN size_t RingBufferIndex_discardRecords(RingBufferIndex *ri,
+                                                        size_t k);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef RINGBUFFER_HEADER_ONLY
+#include "../src/RingBufferIndex.c"
+#endif
+
+#endif // _RINGBUFFERINDEX_H
@@ -0,0 +1,96 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Declares functions that transfer bytes between RingBuffer and file
+ * descriptors.
+ *
+ * The functions transfer bytes directly between the ring buffer's data memory
+ * and the file descriptor with one scatter/gather system call, without copying
+ * them through a buffer of the caller's.
+ *
+ * The functions are only available on POSIX systems and are not thread safe.
+ */
+
+#ifndef _RINGBUFFERIO_H
+#define _RINGBUFFERIO_H
+
+#include "RingBuffer.h"
+#include <sys/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Reads bytes from a file descriptor into the ring buffer.
+ *
+ * Reads with one @c readv() call into the one or two free regions that follow
+ * the ring buffer's write position, then advances the write position by the
+ * number of bytes read. Retries if interrupted by a signal. A full growable
+ * ring buffer doubles its capacity first.
+ *
+ * With a non-blocking file descriptor that has no bytes ready, returns -1 with
+ * @c errno set to @c EAGAIN or @c EWOULDBLOCK and leaves the ring buffer
+ * unchanged.
+ *
+ * No reservation may be outstanding, see RingBuffer_reserveBytes().
+ *
+ * @param[in,out]   rb  The ring buffer, must not be @c NULL.
+ * @param[in]       fd  The file descriptor.
+ * @param[in]       len The maximum number of bytes to read.
+ *
+ * @return  The number of bytes read, zero at end of file, or -1 with @c errno
+ *          set if a parameter is invalid (@c EINVAL), the ring buffer is full
+ *          (@c ENOBUFS) or @c readv() fails.
+ */
+extern ssize_t RingBuffer_readFromFd(RingBuffer *rb, int fd, size_t len);
+
+/**
+ * Writes bytes from the ring buffer to a file descriptor.
+ *
+ * Writes with one @c writev() call from the one or two regions that hold the
+ * bytes at the ring buffer's read position, then advances the read position by
+ * the number of bytes written. Retries if interrupted by a signal.
+ *
+ * With a non-blocking file descriptor that cannot take any bytes, returns -1
+ * with @c errno set to @c EAGAIN or @c EWOULDBLOCK and leaves the ring buffer
+ * unchanged.
+ *
+ * @param[in,out]   rb  The ring buffer, must not be @c NULL.
+ * @param[in]       fd  The file descriptor.
+ * @param[in]       len The maximum number of bytes to write.
+ *
+ * @return  The number of bytes written, zero if the ring buffer is empty, or
+ *          -1 with @c errno set if a parameter is invalid (@c EINVAL) or
+ *          @c writev() fails.
+ */
+extern ssize_t RingBuffer_writeToFd(RingBuffer *rb, int fd, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _RINGBUFFERIO_H
@@ -0,0 +1,95 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Declares functions that allocate mirrored data memory for RingBuffer.
+ *
+ * Mirrored data memory maps the same memory twice, back to back, so that any
+ * range of up to the capacity starting inside the first mapping is contiguous.
+ * See RingBuffer_initializeMirrored().
+ *
+ * The functions are only available on Linux.
+ */
+
+#ifndef _RINGBUFFERMIRROR_H
+#define _RINGBUFFERMIRROR_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Returns the granularity in bytes of mirrored data memory capacities.
+ *
+ * This is the system page size.
+ */
+extern size_t RingBufferMirror_getPageSize(void);
+
+/**
+ * Returns the smallest mirrored data memory capacity in bytes that is at least
+ * @p cap bytes.
+ *
+ * Returns zero if no such capacity exists.
+ *
+ * @param[in]   cap The requested capacity in bytes.
+ */
+extern size_t RingBufferMirror_roundCapacity(size_t cap);
+
+/**
+ * Allocates mirrored data memory.
+ *
+ * Maps an anonymous memory file of @p cap bytes twice, back to back, into
+ * <code>2 * cap</code> bytes of address space.
+ *
+ * Returns @c NULL and sets @c errno if the allocation fails.
+ *
+ * @param[in]   cap The capacity in bytes, must be a nonzero multiple of the
+ *                  page size.
+ *
+ * @return  The mirrored data memory or @c NULL.
+ */
+extern void *RingBufferMirror_allocate(size_t cap);
+
+/**
+ * Frees mirrored data memory.
+ *
+ * @param[in]   data    The mirrored data memory, must have been returned by
+ *                      RingBufferMirror_allocate().
+ * @param[in]   cap     The capacity in bytes passed to
+ *                      RingBufferMirror_allocate().
+ *
+ * @retval  false   A parameter is invalid or the memory could not be unmapped.
+ * @retval  true    Success.
+ */
+extern bool RingBufferMirror_free(void *data, size_t cap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _RINGBUFFERMIRROR_H
@@ -0,0 +1,207 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Declares RingBufferMpmc and associated functions.
+ *
+ * The functions are thread safe for any number of producer threads and any
+ * number of consumer threads. Functions documented as producer functions may be
+ * called by any producer thread, and functions documented as consumer
+ * functions may be called by any consumer thread. The other functions are not
+ * thread safe.
+ */
+
+#ifndef _RINGBUFFERMPMC_H
+#define _RINGBUFFERMPMC_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * The cache line size in bytes assumed for separating the producers' and the
+ * consumers' data.
+ */
+#ifndef RINGBUFFERMPMC_CACHE_LINE_SIZE
+#define RINGBUFFERMPMC_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * A multi-producer/multi-consumer lock-free ring buffer of fixed-size
+ * elements.
+ *
+ * The data memory holds a power-of-two number of slots, each holding a
+ * sequence number followed by an element. A slot's sequence number tells the
+ * producers when the slot is free for the element at a given enqueue index and
+ * tells the consumers when the element at a given dequeue index is ready, so
+ * each enqueue or dequeue only needs one compare-and-swap on its own index.
+ *
+ * When allocating a ring buffer dynamically, use memory aligned to
+ * @c RINGBUFFERMPMC_CACHE_LINE_SIZE.
+ */
+typedef struct {
+    uint8_t *_data;
+    size_t _elemSize;
+    size_t _slotSize;
+    size_t _mask;
+    _Alignas(RINGBUFFERMPMC_CACHE_LINE_SIZE) atomic_size_t _epos;
+    _Alignas(RINGBUFFERMPMC_CACHE_LINE_SIZE) atomic_size_t _dpos;
+} RingBufferMpmc;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Returns the number of bytes of data memory needed for an MPMC ring buffer of
+ * @p count elements of @p elemSize bytes.
+ *
+ * Returns zero if a parameter is zero or the size is too large.
+ *
+ * @param[in]   elemSize    The element size in bytes.
+ * @param[in]   count       The number of elements, should be a power of two.
+ */
+extern size_t RingBufferMpmc_getMemorySize(size_t elemSize, size_t count);
+
+/**
+ * Initializes the MPMC ring buffer.
+ *
+ * The element capacity is the greatest power of two number of elements that
+ * fits in the data memory, so that pre-allocated memory such as huge pages can
+ * be used as is.
+ *
+ * @param[out]      rb          The MPMC ring buffer, must not be @c NULL.
+ * @param[in,out]   data        The data memory, or external memory for storing
+ *                              the elements, must not be @c NULL and must be
+ *                              aligned to <code>_Alignof(atomic_size_t)</code>.
+ * @param[in]       cap         The data memory capacity in bytes, must fit at
+ *                              least two elements.
+ * @param[in]       elemSize    The element size in bytes, must not be zero.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+extern bool RingBufferMpmc_initialize(RingBufferMpmc *rb, void *data,
+                                      size_t cap, size_t elemSize);
+
+/**
+ * Returns the MPMC ring buffer's data memory pointer.
+ *
+ * Returns @c NULL if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The MPMC ring buffer, must not be @c NULL.
+ */
+inline void *RingBufferMpmc_getDataPointer(const RingBufferMpmc *rb) {
+    return (rb != NULL) ? rb->_data : NULL;
+}
+
+/**
+ * Returns the MPMC ring buffer's element size in bytes.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The MPMC ring buffer, must not be @c NULL.
+ */
+inline size_t RingBufferMpmc_getElementSize(const RingBufferMpmc *rb) {
+    return (rb != NULL) ? rb->_elemSize : 0;
+}
+
+/**
+ * Returns the MPMC ring buffer's capacity in elements.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The MPMC ring buffer, must not be @c NULL.
+ */
+inline size_t RingBufferMpmc_getElementCapacity(const RingBufferMpmc *rb) {
+    return (rb != NULL) ? (rb->_mask + 1) : 0;
+}
+
+/**
+ * Enqueues an element to the MPMC ring buffer.
+ *
+ * This is a producer function.
+ *
+ * @param[in,out]   rb      The MPMC ring buffer, must not be @c NULL.
+ * @param[in]       elem    The element, must not be @c NULL.
+ *
+ * @retval  false   A parameter is invalid or the ring buffer is full.
+ * @retval  true    Success.
+ */
+extern bool RingBufferMpmc_enqueue(RingBufferMpmc *rb, const void *elem);
+
+/**
+ * Enqueues elements to the MPMC ring buffer.
+ *
+ * Claims as many consecutive slots as are free, up to @p count, with one
+ * compare-and-swap.
+ *
+ * This is a producer function.
+ *
+ * @param[in,out]   rb      The MPMC ring buffer, must not be @c NULL.
+ * @param[in]       elems   The elements, must not be @c NULL.
+ * @param[in]       count   The number of elements to enqueue.
+ *
+ * @return  The number of elements enqueued or zero if a parameter is invalid.
+ */
+extern size_t RingBufferMpmc_enqueueBatch(RingBufferMpmc *rb,
+                                          const void *elems, size_t count);
+
+/**
+ * Dequeues an element from the MPMC ring buffer.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb      The MPMC ring buffer, must not be @c NULL.
+ * @param[out]      elem    The element, must not be @c NULL.
+ *
+ * @retval  false   A parameter is invalid or the ring buffer is empty.
+ * @retval  true    Success.
+ */
+extern bool RingBufferMpmc_dequeue(RingBufferMpmc *rb, void *elem);
+
+/**
+ * Dequeues elements from the MPMC ring buffer.
+ *
+ * Claims as many consecutive ready slots as there are, up to @p count, with
+ * one compare-and-swap.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb      The MPMC ring buffer, must not be @c NULL.
+ * @param[out]      elems   The elements, must not be @c NULL.
+ * @param[in]       count   The number of elements to dequeue.
+ *
+ * @return  The number of elements dequeued or zero if a parameter is invalid.
+ */
+extern size_t RingBufferMpmc_dequeueBatch(RingBufferMpmc *rb, void *elems,
+                                          size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _RINGBUFFERMPMC_H
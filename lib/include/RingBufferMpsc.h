@@ -0,0 +1,288 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Declares RingBufferMpsc and associated functions.
+ *
+ * The functions are thread safe for any number of producer threads and one
+ * consumer thread. Functions documented as producer functions may be called by
+ * any producer thread, and functions documented as consumer functions must only
+ * be called by the consumer thread. The other functions are not thread safe.
+ */
+
+#ifndef _RINGBUFFERMPSC_H
+#define _RINGBUFFERMPSC_H
+
+#include "RingBuffer.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * The cache line size in bytes assumed for separating the producers' and the
+ * consumer's data.
+ */
+#ifndef RINGBUFFERMPSC_CACHE_LINE_SIZE
+#define RINGBUFFERMPSC_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * The size in bytes of a record header and the alignment of records in the
+ * data memory.
+ */
+#define RINGBUFFERMPSC_HEADER_SIZE 8
+
+/**
+ * Returns the number of bytes of data memory taken by a record of @p len bytes.
+ */
+#define RINGBUFFERMPSC_RECORD_SIZE(len)                                        \
+    (RINGBUFFERMPSC_HEADER_SIZE +                                              \
+     (((len) + RINGBUFFERMPSC_HEADER_SIZE - 1) &                               \
+      ~(size_t)(RINGBUFFERMPSC_HEADER_SIZE - 1)))
+
+/**
+ * A multi-producer/single-consumer lock-free ring buffer of records.
+ *
+ * A producer claims room for a record by advancing the shared write index,
+ * fills the claimed room without holding a lock, and then commits the record
+ * by publishing its header. The consumer reads records in claim order and
+ * stops at the first record not yet committed, so a slow producer delays the
+ * records claimed after its own but never exposes partially written bytes.
+ *
+ * Each record starts with a header of @c RINGBUFFERMPSC_HEADER_SIZE bytes that
+ * never wraps around the end of the data memory, while the record's bytes may
+ * wrap, in which case they take two segments, as with
+ * RingBuffer_reserveBytes().
+ *
+ * When allocating a ring buffer dynamically, use memory aligned to
+ * @c RINGBUFFERMPSC_CACHE_LINE_SIZE.
+ */
+typedef struct {
+    uint8_t *_data;
+    size_t _cap;
+    _Alignas(RINGBUFFERMPSC_CACHE_LINE_SIZE) atomic_size_t _wpos;
+    _Alignas(RINGBUFFERMPSC_CACHE_LINE_SIZE) atomic_size_t _rpos;
+} RingBufferMpsc;
+
+/**
+ * A record claimed by RingBufferMpsc_claimBytes().
+ */
+typedef struct {
+    RingBufferSegment seg[2]; ///< The regions to fill with the record's bytes.
+    size_t _off;
+    size_t _len;
+} RingBufferMpscClaim;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Initializes the MPSC ring buffer.
+ *
+ * Zeroes the data memory, which the ring buffer relies on to tell committed
+ * records from claimed ones.
+ *
+ * @param[out]      rb      The MPSC ring buffer, must not be @c NULL.
+ * @param[in,out]   data    The data memory, or external memory for storing the
+ *                          data, must not be @c NULL and must be aligned to
+ *                          @c RINGBUFFERMPSC_HEADER_SIZE.
+ * @param[in]       cap     The data memory capacity in bytes, must be a
+ *                          non-zero multiple of @c RINGBUFFERMPSC_HEADER_SIZE
+ *                          and not greater than <code>SIZE_MAX / 2</code>.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+extern bool RingBufferMpsc_initialize(RingBufferMpsc *rb, void *data,
+                                      size_t cap);
+
+/**
+ * Returns the MPSC ring buffer's data memory pointer.
+ *
+ * Returns @c NULL if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The MPSC ring buffer, must not be @c NULL.
+ */
+inline void *RingBufferMpsc_getDataPointer(const RingBufferMpsc *rb) {
+    return (rb != NULL) ? rb->_data : NULL;
+}
+
+/**
+ * Returns the MPSC ring buffer's data memory capacity in bytes.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The MPSC ring buffer, must not be @c NULL.
+ */
+inline size_t RingBufferMpsc_getByteCapacity(const RingBufferMpsc *rb) {
+    return (rb != NULL) ? rb->_cap : 0;
+}
+
+/**
+ * Returns whether the MPSC ring buffer is empty, that is, holds neither
+ * committed nor claimed records.
+ *
+ * Returns @c true if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The MPSC ring buffer, must not be @c NULL.
+ */
+inline bool RingBufferMpsc_isEmpty(RingBufferMpsc *rb) {
+    return (rb == NULL) ||
+           (atomic_load_explicit(&rb->_wpos, memory_order_acquire) ==
+            atomic_load_explicit(&rb->_rpos, memory_order_acquire));
+}
+
+/**
+ * Claims room for a record in the MPSC ring buffer.
+ *
+ * The record takes <code>RINGBUFFERMPSC_RECORD_SIZE(len)</code> bytes of data
+ * memory. The producer fills the claimed regions and then passes the claim to
+ * RingBufferMpsc_commitBytes() or RingBufferMpsc_abortBytes(). Until then the
+ * consumer cannot read this record or any record claimed after it.
+ *
+ * This is a producer function.
+ *
+ * @param[in,out]   rb      The MPSC ring buffer, must not be @c NULL.
+ * @param[out]      claim   The claim, must not be @c NULL.
+ * @param[in]       len     The number of bytes in the record.
+ *
+ * @retval  false   A parameter is invalid or the ring buffer does not have
+ *                  room for the record.
+ * @retval  true    Success.
+ */
+extern bool RingBufferMpsc_claimBytes(RingBufferMpsc *rb,
+                                      RingBufferMpscClaim *claim, size_t len);
+
+/**
+ * Commits a record claimed by RingBufferMpsc_claimBytes(), making it readable
+ * by the consumer.
+ *
+ * This is a producer function.
+ *
+ * @param[in,out]   rb      The MPSC ring buffer, must not be @c NULL.
+ * @param[in]       claim   The claim, must not be @c NULL.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+extern bool RingBufferMpsc_commitBytes(RingBufferMpsc *rb,
+                                       const RingBufferMpscClaim *claim);
+
+/**
+ * Aborts a record claimed by RingBufferMpsc_claimBytes().
+ *
+ * The consumer skips the record's data memory instead of reading it.
+ *
+ * This is a producer function.
+ *
+ * @param[in,out]   rb      The MPSC ring buffer, must not be @c NULL.
+ * @param[in]       claim   The claim, must not be @c NULL.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+extern bool RingBufferMpsc_abortBytes(RingBufferMpsc *rb,
+                                      const RingBufferMpscClaim *claim);
+
+/**
+ * Writes a record to the MPSC ring buffer.
+ *
+ * This claims room for the record, copies the bytes and commits the record.
+ *
+ * This is a producer function.
+ *
+ * @param[in,out]   rb  The MPSC ring buffer, must not be @c NULL.
+ * @param[in]       buf The source memory, must not be @c NULL.
+ * @param[in]       len The number of bytes in the record.
+ *
+ * @retval  false   A parameter is invalid or the ring buffer does not have
+ *                  room for the record.
+ * @retval  true    Success.
+ */
+extern bool RingBufferMpsc_writeBytes(RingBufferMpsc *rb, const void *buf,
+                                      size_t len);
+
+/**
+ * Peeks the oldest committed record in place in the MPSC ring buffer.
+ *
+ * Returns the one or two regions of data memory holding the record's bytes.
+ * The second region has zero bytes unless the record wraps around the end of
+ * the data memory. The regions stay valid until the record is discarded.
+ *
+ * Releases aborted records on the way.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb  The MPSC ring buffer, must not be @c NULL.
+ * @param[out]      seg The regions holding the record, must not be @c NULL.
+ *
+ * @retval  false   A parameter is invalid or the oldest record is not
+ *                  committed yet.
+ * @retval  true    Success.
+ */
+extern bool RingBufferMpsc_peekRecord(RingBufferMpsc *rb,
+                                      RingBufferSegment seg[2]);
+
+/**
+ * Discards the oldest committed record from the MPSC ring buffer, releasing its
+ * data memory to the producers.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb  The MPSC ring buffer, must not be @c NULL.
+ *
+ * @retval  false   A parameter is invalid or the oldest record is not
+ *                  committed yet.
+ * @retval  true    Success.
+ */
+extern bool RingBufferMpsc_discardRecord(RingBufferMpsc *rb);
+
+/**
+ * Reads the oldest committed record from the MPSC ring buffer.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb  The MPSC ring buffer, must not be @c NULL.
+ * @param[out]      buf The destination memory, must not be @c NULL.
+ * @param[in]       cap The destination memory capacity in bytes.
+ * @param[out]      len The number of bytes in the record, must not be
+ *                      @c NULL. Set to zero if the oldest record is not
+ *                      committed yet, and set even when the record does not
+ *                      fit, so that the caller can retry with a larger buffer.
+ *
+ * @retval  false   A parameter is invalid, the oldest record is not committed
+ *                  yet or the record does not fit in the destination memory.
+ * @retval  true    Success.
+ */
+extern bool RingBufferMpsc_readRecord(RingBufferMpsc *rb, void *buf,
+                                      size_t cap, size_t *len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _RINGBUFFERMPSC_H
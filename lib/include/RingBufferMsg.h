@@ -0,0 +1,215 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Declares RingBufferMsg and associated functions.
+ *
+ * The functions are not thread safe.
+ */
+
+#ifndef _RINGBUFFERMSG_H
+#define _RINGBUFFERMSG_H
+
+#include "RingBuffer.h"
+#include "RingBufferConfig.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * The maximum number of bytes in a message header.
+ */
+#define RINGBUFFERMSG_MAX_HEADER_SIZE ((sizeof(size_t) * 8 + 6) / 7)
+
+/**
+ * A ring buffer of variable-size messages.
+ *
+ * Wraps a RingBuffer and frames each message with a header holding the
+ * message's length as a variable-length integer, seven bits per byte, least
+ * significant group first, with the high bit set on all but the last byte.
+ * Messages shorter than 128 bytes take one header byte.
+ *
+ * A message is written whole or not at all, so a reader never sees part of a
+ * message.
+ */
+typedef struct {
+    RingBuffer _rb;
+} RingBufferMsg;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Initializes the message ring buffer.
+ *
+ * @param[out]      rb      The message ring buffer, must not be @c NULL.
+ * @param[in,out]   data    The data memory, or external memory for storing the
+ *                          data, must not be @c NULL.
+ * @param[in]       cap     The data memory capacity in bytes, must not be zero.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+RINGBUFFER_INLINE bool RingBufferMsg_initialize(RingBufferMsg *rb, void *data,
+                                                size_t cap) {
+    return (rb != NULL) && RingBuffer_initialize(&rb->_rb, data, cap);
+}
+
+/**
+ * Resets the message ring buffer, discarding all messages.
+ *
+ * @param[in,out]   rb  The message ring buffer, must not be @c NULL.
+ *
+ * @retval  false   The @p rb parameter is @c NULL.
+ * @retval  true    Success.
+ */
+RINGBUFFER_INLINE bool RingBufferMsg_reset(RingBufferMsg *rb) {
+    return (rb != NULL) && RingBuffer_reset(&rb->_rb);
+}
+
+/**
+ * Returns the message ring buffer's data memory capacity in bytes.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The message ring buffer, must not be @c NULL.
+ */
+RINGBUFFER_INLINE size_t
+RingBufferMsg_getByteCapacity(const RingBufferMsg *rb) {
+    return (rb != NULL) ? RingBuffer_getByteCapacity(&rb->_rb) : 0;
+}
+
+/**
+ * Returns whether the message ring buffer holds no messages.
+ *
+ * Returns @c true if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The message ring buffer, must not be @c NULL.
+ */
+RINGBUFFER_INLINE bool RingBufferMsg_isEmpty(const RingBufferMsg *rb) {
+    return (rb != NULL) ? RingBuffer_isEmpty(&rb->_rb) : true;
+}
+
+/**
+ * Returns the number of bytes of data memory that a message takes, counting
+ * its header.
+ *
+ * @param[in]   len The number of bytes in the message.
+ */
+RINGBUFFER_INLINE size_t RingBufferMsg_getMessageSize(size_t len) {
+    size_t size = len + 1;
+    for (size_t rest = len >> 7; rest != 0; rest >>= 7) {
+        ++size;
+    }
+    return size;
+}
+
+/**
+ * Returns whether a message fits in the message ring buffer now.
+ *
+ * A message ring buffer keeps the data memory it was initialized with and is
+ * never growable, so a message that does not fit in an empty message ring
+ * buffer never will.
+ *
+ * Returns @c false if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The message ring buffer, must not be @c NULL.
+ * @param[in]   len The number of bytes in the message.
+ */
+RINGBUFFER_EXTERN bool RingBufferMsg_fits(const RingBufferMsg *rb, size_t len);
+
+/**
+ * Pushes a message to the message ring buffer.
+ *
+ * Writes the header and the message in one pass, or nothing if the message
+ * does not fit.
+ *
+ * @param[in,out]   rb  The message ring buffer, must not be @c NULL.
+ * @param[in]       buf The message, must not be @c NULL.
+ * @param[in]       len The number of bytes in the message, which may be zero.
+ *
+ * @retval  false   A parameter is invalid or the message does not fit.
+ * @retval  true    Success.
+ */
+RINGBUFFER_EXTERN bool RingBufferMsg_pushMessage(RingBufferMsg *rb,
+                                                 const void *buf, size_t len);
+
+/**
+ * Peeks the oldest message in place in the message ring buffer.
+ *
+ * Returns the one or two regions of data memory holding the message's bytes,
+ * without its header. The second region has zero bytes unless the message
+ * wraps around the end of the data memory. The regions stay valid until the
+ * message is popped, since a message ring buffer is never growable and writes
+ * never move its bytes.
+ *
+ * @param[in]   rb  The message ring buffer, must not be @c NULL.
+ * @param[out]  seg The regions holding the message, must not be @c NULL.
+ *
+ * @retval  false   A parameter is invalid or the ring buffer is empty.
+ * @retval  true    Success.
+ */
+RINGBUFFER_EXTERN bool RingBufferMsg_peekMessage(const RingBufferMsg *rb,
+                                                 RingBufferSegment seg[2]);
+
+/**
+ * Pops the oldest message from the message ring buffer, releasing its data
+ * memory.
+ *
+ * @param[in,out]   rb  The message ring buffer, must not be @c NULL.
+ *
+ * @retval  false   A parameter is invalid or the ring buffer is empty.
+ * @retval  true    Success.
+ */
+RINGBUFFER_EXTERN bool RingBufferMsg_popMessage(RingBufferMsg *rb);
+
+/**
+ * Reads the oldest message from the message ring buffer.
+ *
+ * @param[in,out]   rb  The message ring buffer, must not be @c NULL.
+ * @param[out]      buf The destination memory, must not be @c NULL.
+ * @param[in]       cap The destination memory capacity in bytes.
+ * @param[out]      len The number of bytes in the message, must not be
+ *                      @c NULL. Set to zero if the ring buffer is empty, and
+ *                      set even when the message does not fit, so that the
+ *                      caller can retry with a larger buffer.
+ *
+ * @retval  false   A parameter is invalid, the ring buffer is empty or the
+ *                  message does not fit in the destination memory.
+ * @retval  true    Success.
+ */
+RINGBUFFER_EXTERN bool RingBufferMsg_readMessage(RingBufferMsg *rb, void *buf,
+                                                 size_t cap, size_t *len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef RINGBUFFER_HEADER_ONLY
+#include "../src/RingBufferMsg.c"
+#endif
+
+#endif // _RINGBUFFERMSG_H
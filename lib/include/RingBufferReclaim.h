@@ -0,0 +1,82 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Declares functions that release the physical memory of idle RingBuffer and
+ * RingBufferWo data memory.
+ *
+ * The functions advise the kernel with @c madvise() that whole pages of data
+ * memory are no longer needed, so that a ring buffer sized for its peak load
+ * does not keep that much memory resident while it is mostly empty. The data
+ * memory should be page aligned, such as memory from @c mmap(), or else the
+ * partial pages at its ends stay resident.
+ *
+ * The functions are only available on POSIX systems and are not thread safe.
+ */
+
+#ifndef _RINGBUFFERRECLAIM_H
+#define _RINGBUFFERRECLAIM_H
+
+#include "RingBuffer.h"
+#include "RingBufferWo.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Releases the physical memory of the whole pages in data memory.
+ *
+ * Uses @c MADV_REMOVE for mirrored, and therefore shared, data memory on
+ * Linux, so that the pages are freed rather than only unmapped, and otherwise
+ * @c MADV_DONTNEED on Linux or @c MADV_FREE where available. Pass it to
+ * RingBuffer_setReclaimer().
+ *
+ * @param[in,out]   data        The data memory, must not be @c NULL.
+ * @param[in]       len         The number of bytes of data memory.
+ * @param[in]       mirrored    Whether the data memory is mirrored.
+ *
+ * @return  The number of bytes released, or zero if a parameter is invalid or
+ *          @c madvise() fails.
+ */
+extern size_t RingBufferReclaim_releasePages(void *data, size_t len,
+                                             bool mirrored);
+
+/**
+ * Resets the ring buffer and releases the physical memory of the whole pages
+ * of its data memory.
+ *
+ * @param[in,out]   rb  The ring buffer, must not be @c NULL.
+ *
+ * @return  The number of bytes released, or zero if the @p rb parameter is
+ *          @c NULL or @c madvise() fails.
+ */
+extern size_t RingBufferWo_resetAndReclaim(RingBufferWo *rb);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _RINGBUFFERRECLAIM_H
@@ -32,6 +32,7 @@ SOFTWARE.
 #ifndef _RINGBUFFERRO_H
 #define _RINGBUFFERRO_H
 
+#include "RingBufferConfig.h"
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -46,6 +47,8 @@ SOFTWARE.
 typedef struct {
     uint8_t *_data;
     size_t _cap;
+    size_t _mask;
+    uint64_t _recip;
     size_t _rpos;
 } RingBufferRo;
 
@@ -56,6 +59,10 @@ extern "C" {
 /**
  * Initializes the read-only ring buffer.
  *
+ * A power-of-two capacity lets the ring buffer wrap its read position with a
+ * mask. Any other capacity up to @c UINT32_MAX wraps it with a precomputed
+ * reciprocal instead of a division.
+ *
  * @param[out]      rb      The read-only ring buffer, must not be @c NULL.
  * @param[in,out]   data    The data memory, or external memory for storing the
  *                          data, must not be @c NULL.
@@ -64,12 +71,17 @@ extern "C" {
  * @retval  false   A parameter is invalid.
  * @retval  true    Success.
  */
-inline bool RingBufferRo_initialize(RingBufferRo *rb, void *data, size_t cap) {
+RINGBUFFER_INLINE bool RingBufferRo_initialize(RingBufferRo *rb, void *data,
+                                               size_t cap) {
     if ((rb == NULL) || (data == NULL) || (cap == 0)) {
         return false;
     }
     rb->_data = (uint8_t *)data;
     rb->_cap = cap;
+    rb->_mask = ((cap & (cap - 1)) == 0) ? (cap - 1) : 0;
+    rb->_recip = ((rb->_mask == 0) && (cap <= UINT32_MAX))
+                     ? (UINT64_MAX / cap + 1)
+                     : 0;
     rb->_rpos = 0;
     return true;
 }
@@ -82,8 +94,8 @@ inline bool RingBufferRo_initialize(RingBufferRo *rb, void *data, size_t cap) {
  * @retval  false   The @p rb parameter is @c NULL.
  * @retval  true    Success.
  */
-inline bool RingBufferRo_reset(RingBufferRo *rb) {
-    if (rb == NULL) {
+RINGBUFFER_INLINE bool RingBufferRo_reset(RingBufferRo *rb) {
+    if (RINGBUFFER_ISNULL(rb)) {
         return false;
     }
     rb->_rpos = 0;
@@ -97,8 +109,8 @@ inline bool RingBufferRo_reset(RingBufferRo *rb) {
  *
  * @param[in]   rb  The read-only ring buffer, must not be @c NULL.
  */
-inline void *RingBufferRo_getDataPointer(const RingBufferRo *rb) {
-    return (rb != NULL) ? rb->_data : NULL;
+RINGBUFFER_INLINE void *RingBufferRo_getDataPointer(const RingBufferRo *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? rb->_data : NULL;
 }
 
 /**
@@ -108,8 +120,8 @@ inline void *RingBufferRo_getDataPointer(const RingBufferRo *rb) {
  *
  * @param[in]   rb  The read-only ring buffer, must not be @c NULL.
  */
-inline size_t RingBufferRo_getByteCapacity(const RingBufferRo *rb) {
-    return (rb != NULL) ? rb->_cap : 0;
+RINGBUFFER_INLINE size_t RingBufferRo_getByteCapacity(const RingBufferRo *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? rb->_cap : 0;
 }
 
 /**
@@ -119,8 +131,9 @@ inline size_t RingBufferRo_getByteCapacity(const RingBufferRo *rb) {
  *
  * @param[in]   rb  The read-only ring buffer, must not be @c NULL.
  */
-inline size_t RingBufferRo_getReadBytePosition(const RingBufferRo *rb) {
-    return (rb != NULL) ? rb->_rpos : 0;
+RINGBUFFER_INLINE size_t
+RingBufferRo_getReadBytePosition(const RingBufferRo *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? rb->_rpos : 0;
 }
 
 /**
@@ -131,13 +144,8 @@ inline size_t RingBufferRo_getReadBytePosition(const RingBufferRo *rb) {
  *
  * @return  The number of bytes skipped or zero if a parameter is invalid.
  */
-inline size_t RingBufferRo_discardBytes(RingBufferRo *rb, size_t len) {
-    if ((rb == NULL) || (len == 0)) {
-        return 0;
-    }
-    rb->_rpos = (rb->_rpos + len) % rb->_cap;
-    return len;
-}
+RINGBUFFER_EXTERN size_t RingBufferRo_discardBytes(RingBufferRo *rb,
+                                                   size_t len);
 
 /**
  * Reads bytes from the read-only ring buffer.
@@ -149,7 +157,8 @@ inline size_t RingBufferRo_discardBytes(RingBufferRo *rb, size_t len) {
  *
  * @return  The number of bytes copied or zero if a parameter is invalid.
  */
-extern size_t RingBufferRo_readBytes(RingBufferRo *rb, void *buf, size_t len);
+RINGBUFFER_EXTERN size_t RingBufferRo_readBytes(RingBufferRo *rb, void *buf,
+                                                size_t len);
 
 /**
  * Peeks bytes from the read-only ring buffer.
@@ -163,8 +172,8 @@ extern size_t RingBufferRo_readBytes(RingBufferRo *rb, void *buf, size_t len);
  * @return  The number of bytes copied to the destination buffer or zero if a
  *          parameter is invalid.
  */
-extern size_t RingBufferRo_peekBytes(const RingBufferRo *rb, void *buf,
-                                     size_t len);
+RINGBUFFER_EXTERN size_t RingBufferRo_peekBytes(const RingBufferRo *rb,
+                                                void *buf, size_t len);
 
 /**
  * Peeks bytes from the read-only ring buffer at an offset from the ring
@@ -179,11 +188,16 @@ extern size_t RingBufferRo_peekBytes(const RingBufferRo *rb, void *buf,
  * @return  The number of bytes copied to the destination buffer or zero if a
  *          parameter is invalid.
  */
-extern size_t RingBufferRo_peekBytesAt(const RingBufferRo *rb, size_t pos,
-                                       void *buf, size_t len);
+RINGBUFFER_EXTERN size_t RingBufferRo_peekBytesAt(const RingBufferRo *rb,
+                                                  size_t pos, void *buf,
+                                                  size_t len);
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif // _RINGBUFFERRO_H
\ No newline at end of file
+#ifdef RINGBUFFER_HEADER_ONLY
+#include "../src/RingBufferRo.c"
+#endif
+
+#endif // _RINGBUFFERRO_H
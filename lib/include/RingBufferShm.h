@@ -0,0 +1,309 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Declares RingBufferShm and associated functions.
+ *
+ * The functions are thread safe and process safe for one producer and one
+ * consumer. Functions documented as producer functions must only be called by
+ * the producer, and functions documented as consumer functions must only be
+ * called by the consumer. The other functions are not thread safe.
+ */
+
+#ifndef _RINGBUFFERSHM_H
+#define _RINGBUFFERSHM_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * The value identifying a region initialized by RingBufferShm_initialize().
+ */
+#define RINGBUFFERSHM_MAGIC 0x52425348u
+
+/**
+ * The version of the RingBufferShm region layout.
+ */
+#define RINGBUFFERSHM_VERSION 2u
+
+/**
+ * The cache line size in bytes assumed for separating the producer's and the
+ * consumer's data.
+ */
+#ifndef RINGBUFFERSHM_CACHE_LINE_SIZE
+#define RINGBUFFERSHM_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * The header of a RingBufferShm region, shared between processes.
+ *
+ * It lives at the start of a memory region, such as one from @c shm_open() or
+ * @c memfd_create(), and the data memory follows it in the same region. It
+ * holds offsets rather than pointers, so each process can map the region at a
+ * different address. The indices are lock-free atomics on separate cache
+ * lines, as in RingBufferSpsc.
+ */
+typedef struct {
+    _Atomic uint32_t _magic;
+    uint32_t _version;
+    uint64_t _cap;
+    uint64_t _offset;
+    _Alignas(RINGBUFFERSHM_CACHE_LINE_SIZE) _Atomic uint64_t _wpos;
+    _Alignas(RINGBUFFERSHM_CACHE_LINE_SIZE) _Atomic uint64_t _rpos;
+} RingBufferShmRegion;
+
+/**
+ * A process's handle on a single-producer/single-consumer ring buffer in a
+ * shared memory region.
+ *
+ * One process initializes the region with RingBufferShm_initialize(), and the
+ * others attach to it with RingBufferShm_attach(), which validates the magic
+ * value, the layout version and the capacity. Either copies the capacity and
+ * the data memory pointer into the handle, so that the other processes cannot
+ * change them afterwards, and the handle keeps its own cached copy of the other
+ * side's index.
+ */
+typedef struct {
+    RingBufferShmRegion *_region;
+    uint8_t *_data;
+    size_t _cap;
+    _Alignas(RINGBUFFERSHM_CACHE_LINE_SIZE) uint64_t _rposCache;
+    _Alignas(RINGBUFFERSHM_CACHE_LINE_SIZE) uint64_t _wposCache;
+} RingBufferShm;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Returns the size in bytes of the region needed for a shared ring buffer with
+ * a data memory capacity of @p cap bytes.
+ *
+ * Returns zero if the capacity is too large.
+ *
+ * @param[in]   cap The data memory capacity in bytes.
+ */
+extern size_t RingBufferShm_getRegionSize(size_t cap);
+
+/**
+ * Initializes a shared ring buffer in a memory region, and a handle on it.
+ *
+ * The data memory capacity is the region size less the size of the
+ * RingBufferShmRegion header. The magic value is published last, so a
+ * concurrent RingBufferShm_attach() never sees a partially initialized region.
+ *
+ * @param[out]      rb      The handle, must not be @c NULL.
+ * @param[in,out]   mem     The region, must not be @c NULL and must be aligned
+ *                          to @c RINGBUFFERSHM_CACHE_LINE_SIZE.
+ * @param[in]       size    The region size in bytes, must be greater than the
+ *                          size of the RingBufferShmRegion header.
+ *
+ * @retval  false   A parameter is invalid or the platform's 64-bit atomics are
+ *                  not lock-free.
+ * @retval  true    Success.
+ */
+extern bool RingBufferShm_initialize(RingBufferShm *rb, void *mem,
+                                     size_t size);
+
+/**
+ * Initializes a handle on a shared ring buffer initialized by
+ * RingBufferShm_initialize(), possibly by another process at another address.
+ *
+ * @param[out]      rb      The handle, must not be @c NULL.
+ * @param[in,out]   mem     The region, must not be @c NULL.
+ * @param[in]       size    The region size in bytes.
+ *
+ * @retval  false   A parameter is invalid, the region's magic value or layout
+ *                  version does not match, or its capacity or indices do not
+ *                  fit in the region.
+ * @retval  true    Success.
+ */
+extern bool RingBufferShm_attach(RingBufferShm *rb, void *mem, size_t size);
+
+/**
+ * Returns the shared ring buffer's data memory pointer in the calling process.
+ *
+ * Returns @c NULL if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The shared ring buffer, must not be @c NULL.
+ */
+inline void *RingBufferShm_getDataPointer(const RingBufferShm *rb) {
+    return (rb != NULL) ? rb->_data : NULL;
+}
+
+/**
+ * Returns the shared ring buffer's data memory capacity in bytes.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The shared ring buffer, must not be @c NULL.
+ */
+inline size_t RingBufferShm_getByteCapacity(const RingBufferShm *rb) {
+    return (rb != NULL) ? rb->_cap : 0;
+}
+
+/**
+ * Returns the number of bytes that can be written to the shared ring buffer
+ * before the ring buffer becomes full.
+ *
+ * This is a producer function.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The shared ring buffer, must not be @c NULL.
+ */
+extern size_t RingBufferShm_getWriteByteCapacity(RingBufferShm *rb);
+
+/**
+ * Returns the number of bytes that can be read from the shared ring buffer
+ * before the ring buffer becomes empty.
+ *
+ * This is a consumer function.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The shared ring buffer, must not be @c NULL.
+ */
+extern size_t RingBufferShm_getReadByteCapacity(RingBufferShm *rb);
+
+/**
+ * Returns whether the shared ring buffer is empty.
+ *
+ * This is equivalent to
+ * <code>RingBufferShm_getReadByteCapacity(rb) == 0</code> and provided for
+ * expressive clarity and convenience.
+ *
+ * This is a consumer function.
+ *
+ * Returns @c true if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The shared ring buffer, must not be @c NULL.
+ */
+inline bool RingBufferShm_isEmpty(RingBufferShm *rb) {
+    return RingBufferShm_getReadByteCapacity(rb) == 0;
+}
+
+/**
+ * Returns whether the shared ring buffer is full.
+ *
+ * This is equivalent to
+ * <code>RingBufferShm_getWriteByteCapacity(rb) == 0</code> and provided for
+ * expressive clarity and convenience.
+ *
+ * This is a producer function.
+ *
+ * Returns @c true if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The shared ring buffer, must not be @c NULL.
+ */
+inline bool RingBufferShm_isFull(RingBufferShm *rb) {
+    return RingBufferShm_getWriteByteCapacity(rb) == 0;
+}
+
+/**
+ * Writes bytes to the shared ring buffer.
+ *
+ * This is a producer function.
+ *
+ * @param[in,out]   rb  The shared ring buffer, must not be @c NULL.
+ * @param[in]       buf The source memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to copy from the source memory to
+ *                      the ring buffer.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid.
+ */
+extern size_t RingBufferShm_writeBytes(RingBufferShm *rb, const void *buf,
+                                       size_t len);
+
+/**
+ * Discards bytes from the shared ring buffer.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb  The shared ring buffer, must not be @c NULL.
+ * @param[in]       len The number of bytes to skip.
+ *
+ * @return  The number of bytes skipped or zero if a parameter is invalid.
+ */
+extern size_t RingBufferShm_discardBytes(RingBufferShm *rb, size_t len);
+
+/**
+ * Reads bytes from the shared ring buffer.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb  The shared ring buffer, must not be @c NULL.
+ * @param[out]      buf The destination memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to copy from the ring buffer to the
+ *                      destination memory.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid.
+ */
+extern size_t RingBufferShm_readBytes(RingBufferShm *rb, void *buf,
+                                      size_t len);
+
+/**
+ * Peeks bytes from the shared ring buffer.
+ *
+ * This is equivalent to
+ * <code>RingBufferShm_peekBytesAt(rb, 0, buf, len)</code>.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb  The shared ring buffer, must not be @c NULL.
+ * @param[out]      buf The destination memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to peek.
+ *
+ * @return  The number of bytes copied to the destination buffer or zero if a
+ *          parameter is invalid.
+ */
+extern size_t RingBufferShm_peekBytes(RingBufferShm *rb, void *buf,
+                                      size_t len);
+
+/**
+ * Peeks bytes from the shared ring buffer at a byte offset from the ring
+ * buffer's read position.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb  The shared ring buffer, must not be @c NULL.
+ * @param[in]       pos The byte offset from the ring buffer's read position at
+ *                      which to peek.
+ * @param[out]      buf The destination memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to peek.
+ *
+ * @return  The number of bytes copied to the destination buffer or zero if a
+ *          parameter is invalid.
+ */
+extern size_t RingBufferShm_peekBytesAt(RingBufferShm *rb, size_t pos,
+                                        void *buf, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _RINGBUFFERSHM_H
@@ -0,0 +1,631 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Declares RingBufferSpsc and associated functions.
+ *
+ * The functions are thread safe for one producer thread and one consumer
+ * thread. Functions documented as producer functions must only be called by
+ * the producer thread, and functions documented as consumer functions must only
+ * be called by the consumer thread. The other functions are not thread safe.
+ */
+
+#ifndef _RINGBUFFERSPSC_H
+#define _RINGBUFFERSPSC_H
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * The cache line size in bytes assumed for separating the producer's and the
+ * consumer's data.
+ */
+#ifndef RINGBUFFERSPSC_CACHE_LINE_SIZE
+#define RINGBUFFERSPSC_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * The timeout in nanoseconds for waiting without a time limit.
+ */
+#define RINGBUFFERSPSC_WAIT_FOREVER UINT64_MAX
+
+/**
+ * A single-producer/single-consumer lock-free ring buffer.
+ *
+ * The producer owns the write index and the consumer owns the read index. Each
+ * index lives on its own cache line together with the owner's cached copy of
+ * the other index, so each side only touches the other side's cache line when
+ * its cached copy says that the ring buffer is full or empty.
+ *
+ * The indices run from zero to twice the capacity so that a full ring buffer
+ * can be told apart from an empty one without a shared length.
+ *
+ * A waitable ring buffer also keeps a waiter flag per side, next to the other
+ * side's index, which the waiting side sets before parking on it and the other
+ * side checks after publishing its index, so that only a side with a waiter
+ * registered makes a system call to wake it.
+ *
+ * On Linux, a ring buffer can also have a pair of event file descriptors, for
+ * event loops. The producer signals the read event file descriptor when the
+ * ring buffer goes from empty to non-empty, and the consumer signals the write
+ * event file descriptor when the ring buffer goes from full to not full.
+ *
+ * When allocating a ring buffer dynamically, use memory aligned to
+ * @c RINGBUFFERSPSC_CACHE_LINE_SIZE.
+ */
+typedef struct {
+    uint8_t *_data;
+    size_t _cap;
+    unsigned _spin;
+    bool _wait;
+    int _readEventFd;
+    int _writeEventFd;
+    _Alignas(RINGBUFFERSPSC_CACHE_LINE_SIZE) atomic_size_t _wpos;
+    size_t _rposCache;
+    _Atomic uint32_t _rwait;
+    _Alignas(RINGBUFFERSPSC_CACHE_LINE_SIZE) atomic_size_t _rpos;
+    size_t _wposCache;
+    _Atomic uint32_t _wwait;
+} RingBufferSpsc;
+
+/**
+ * A batch of bytes written to an SPSC ring buffer by its producer.
+ *
+ * The batch writes bytes against a private copy of the write index and only
+ * publishes them, with a single store to the shared write index, when flushed,
+ * so that many small writes cost one publication.
+ */
+typedef struct {
+    RingBufferSpsc *_rb;
+    size_t _wpos;
+    size_t _pend;
+    size_t _threshold;
+} RingBufferSpscWriteBatch;
+
+/**
+ * A batch of bytes read from an SPSC ring buffer by its consumer.
+ *
+ * The batch reads bytes against a private copy of the read index and only
+ * releases their room to the producer, with a single store to the shared read
+ * index, when flushed, so that many small reads cost one publication.
+ */
+typedef struct {
+    RingBufferSpsc *_rb;
+    size_t _rpos;
+    size_t _pend;
+    size_t _threshold;
+} RingBufferSpscReadBatch;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Initializes the SPSC ring buffer.
+ *
+ * @param[out]      rb      The SPSC ring buffer, must not be @c NULL.
+ * @param[in,out]   data    The data memory, or external memory for storing the
+ *                          data, must not be @c NULL.
+ * @param[in]       cap     The data memory capacity in bytes, must not be zero
+ *                          or greater than <code>SIZE_MAX / 2</code>.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+inline bool RingBufferSpsc_initialize(RingBufferSpsc *rb, void *data,
+                                      size_t cap) {
+    if ((rb == NULL) || (data == NULL) || (cap == 0) || (cap > SIZE_MAX / 2)) {
+        return false;
+    }
+    rb->_data = (uint8_t *)data;
+    rb->_cap = cap;
+    rb->_spin = 0;
+    rb->_wait = false;
+    rb->_readEventFd = -1;
+    rb->_writeEventFd = -1;
+    atomic_init(&rb->_wpos, 0);
+    rb->_rposCache = 0;
+    atomic_init(&rb->_rwait, 0);
+    atomic_init(&rb->_rpos, 0);
+    rb->_wposCache = 0;
+    atomic_init(&rb->_wwait, 0);
+    return true;
+}
+
+/**
+ * Initializes the SPSC ring buffer for RingBufferSpsc_readBytesWait() and
+ * RingBufferSpsc_writeBytesWait().
+ *
+ * A side that waits first spins, checking the ring buffer up to @p spin times,
+ * and then parks, on Linux on a futex, until the other side wakes it. Once
+ * waitable, the ring buffer's producer and consumer functions check for a
+ * waiter after each update, which costs a full memory fence but no system call
+ * unless a waiter is registered.
+ *
+ * @param[out]      rb      The SPSC ring buffer, must not be @c NULL.
+ * @param[in,out]   data    The data memory, or external memory for storing the
+ *                          data, must not be @c NULL.
+ * @param[in]       cap     The data memory capacity in bytes, must not be zero
+ *                          or greater than <code>SIZE_MAX / 2</code>.
+ * @param[in]       spin    The number of times to check the ring buffer before
+ *                          parking.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+extern bool RingBufferSpsc_initializeWaitable(RingBufferSpsc *rb, void *data,
+                                              size_t cap, unsigned spin);
+
+/**
+ * Resets the SPSC ring buffer.
+ *
+ * Neither the producer nor the consumer may access the ring buffer at the same
+ * time.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ *
+ * @retval  false   The @p rb parameter is @c NULL.
+ * @retval  true    Success.
+ */
+inline bool RingBufferSpsc_reset(RingBufferSpsc *rb) {
+    if (rb == NULL) {
+        return false;
+    }
+    atomic_store_explicit(&rb->_wpos, 0, memory_order_relaxed);
+    rb->_rposCache = 0;
+    atomic_store_explicit(&rb->_rwait, 0, memory_order_relaxed);
+    atomic_store_explicit(&rb->_rpos, 0, memory_order_relaxed);
+    rb->_wposCache = 0;
+    atomic_store_explicit(&rb->_wwait, 0, memory_order_relaxed);
+    return true;
+}
+
+/**
+ * Returns the SPSC ring buffer's data memory pointer.
+ *
+ * Returns @c NULL if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The SPSC ring buffer, must not be @c NULL.
+ */
+inline void *RingBufferSpsc_getDataPointer(const RingBufferSpsc *rb) {
+    return (rb != NULL) ? rb->_data : NULL;
+}
+
+/**
+ * Returns the SPSC ring buffer's data memory capacity in bytes.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The SPSC ring buffer, must not be @c NULL.
+ */
+inline size_t RingBufferSpsc_getByteCapacity(const RingBufferSpsc *rb) {
+    return (rb != NULL) ? rb->_cap : 0;
+}
+
+/**
+ * Returns the number of bytes that can be written to the SPSC ring buffer
+ * before the ring buffer becomes full.
+ *
+ * This is a producer function.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ */
+extern size_t RingBufferSpsc_getWriteByteCapacity(RingBufferSpsc *rb);
+
+/**
+ * Returns the number of bytes that can be read from the SPSC ring buffer before
+ * the ring buffer becomes empty.
+ *
+ * This is a consumer function.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ */
+extern size_t RingBufferSpsc_getReadByteCapacity(RingBufferSpsc *rb);
+
+/**
+ * Returns whether the SPSC ring buffer is empty.
+ *
+ * This is equivalent to
+ * <code>RingBufferSpsc_getReadByteCapacity(rb) == 0</code> and provided for
+ * expressive clarity and convenience.
+ *
+ * This is a consumer function.
+ *
+ * Returns @c true if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ */
+inline bool RingBufferSpsc_isEmpty(RingBufferSpsc *rb) {
+    return RingBufferSpsc_getReadByteCapacity(rb) == 0;
+}
+
+/**
+ * Returns whether the SPSC ring buffer is full.
+ *
+ * This is equivalent to
+ * <code>RingBufferSpsc_getWriteByteCapacity(rb) == 0</code> and provided for
+ * expressive clarity and convenience.
+ *
+ * This is a producer function.
+ *
+ * Returns @c true if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ */
+inline bool RingBufferSpsc_isFull(RingBufferSpsc *rb) {
+    return RingBufferSpsc_getWriteByteCapacity(rb) == 0;
+}
+
+/**
+ * Returns the number of bytes than can be written contiguously to the SPSC
+ * ring buffer.
+ *
+ * This is a producer function.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ */
+extern size_t RingBufferSpsc_getWriteByteSpan(RingBufferSpsc *rb);
+
+/**
+ * Returns the number of bytes than can be read contiguously from the SPSC ring
+ * buffer.
+ *
+ * This is a consumer function.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ */
+extern size_t RingBufferSpsc_getReadByteSpan(RingBufferSpsc *rb);
+
+/**
+ * Writes bytes to the SPSC ring buffer.
+ *
+ * This is a producer function.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ * @param[in]       buf The source memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to copy from the source memory to
+ *                      the ring buffer.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid.
+ */
+extern size_t RingBufferSpsc_writeBytes(RingBufferSpsc *rb, const void *buf,
+                                        size_t len);
+
+/**
+ * Discards bytes from the SPSC ring buffer.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ * @param[in]       len The number of bytes to skip.
+ *
+ * @return  The number of bytes skipped or zero if a parameter is invalid.
+ */
+extern size_t RingBufferSpsc_discardBytes(RingBufferSpsc *rb, size_t len);
+
+/**
+ * Reads bytes from the SPSC ring buffer.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ * @param[out]      buf The destination memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to copy from the ring buffer to the
+ *                      destination memory.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid.
+ */
+extern size_t RingBufferSpsc_readBytes(RingBufferSpsc *rb, void *buf,
+                                       size_t len);
+
+/**
+ * Peeks bytes from the SPSC ring buffer.
+ *
+ * This is equivalent to
+ * <code>RingBufferSpsc_peekBytesAt(rb, 0, buf, len)</code>.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ * @param[out]      buf The destination memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to peek.
+ *
+ * @return  The number of bytes copied to the destination buffer or zero if a
+ *          parameter is invalid.
+ */
+extern size_t RingBufferSpsc_peekBytes(RingBufferSpsc *rb, void *buf,
+                                       size_t len);
+
+/**
+ * Peeks bytes from the SPSC ring buffer at a byte offset from the ring
+ * buffer's read position.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ * @param[in]       pos The byte offset from the ring buffer's read position at
+ *                      which to peek.
+ * @param[out]      buf The destination memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to peek.
+ *
+ * @return  The number of bytes copied to the destination buffer or zero if a
+ *          parameter is invalid.
+ */
+extern size_t RingBufferSpsc_peekBytesAt(RingBufferSpsc *rb, size_t pos,
+                                         void *buf, size_t len);
+
+/**
+ * Writes bytes to the waitable SPSC ring buffer, waiting for room if it is
+ * full.
+ *
+ * Waits until at least one byte can be written and then writes as many bytes
+ * as fit, up to @p len.
+ *
+ * This is a producer function.
+ *
+ * @param[in,out]   rb      The SPSC ring buffer, must not be @c NULL and must
+ *                          be initialized by
+ *                          RingBufferSpsc_initializeWaitable().
+ * @param[in]       buf     The source memory, must not be @c NULL.
+ * @param[in]       len     The number of bytes to copy from the source memory
+ *                          to the ring buffer.
+ * @param[in]       timeout The maximum time to wait in nanoseconds, or
+ *                          @c RINGBUFFERSPSC_WAIT_FOREVER.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid or the
+ *          timeout expired.
+ */
+extern size_t RingBufferSpsc_writeBytesWait(RingBufferSpsc *rb,
+                                            const void *buf, size_t len,
+                                            uint64_t timeout);
+
+/**
+ * Reads bytes from the waitable SPSC ring buffer, waiting for bytes if it is
+ * empty.
+ *
+ * Waits until at least one byte can be read and then reads as many bytes as
+ * there are, up to @p len.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rb      The SPSC ring buffer, must not be @c NULL and must
+ *                          be initialized by
+ *                          RingBufferSpsc_initializeWaitable().
+ * @param[out]      buf     The destination memory, must not be @c NULL.
+ * @param[in]       len     The number of bytes to copy from the ring buffer to
+ *                          the destination memory.
+ * @param[in]       timeout The maximum time to wait in nanoseconds, or
+ *                          @c RINGBUFFERSPSC_WAIT_FOREVER.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid or the
+ *          timeout expired.
+ */
+extern size_t RingBufferSpsc_readBytesWait(RingBufferSpsc *rb, void *buf,
+                                           size_t len, uint64_t timeout);
+
+/**
+ * Initializes a write batch for the SPSC ring buffer's producer.
+ *
+ * While the batch holds unpublished bytes, the producer must only write to the
+ * ring buffer through the batch.
+ *
+ * @param[out]      wb          The write batch, must not be @c NULL.
+ * @param[in,out]   rb          The SPSC ring buffer, must not be @c NULL.
+ * @param[in]       threshold   The number of unpublished bytes at which writes
+ *                              flush the batch, or zero to only flush it
+ *                              explicitly.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+extern bool RingBufferSpscWriteBatch_initialize(RingBufferSpscWriteBatch *wb,
+                                                RingBufferSpsc *rb,
+                                                size_t threshold);
+
+/**
+ * Writes bytes to the SPSC ring buffer without publishing them until the batch
+ * is flushed.
+ *
+ * This is a producer function.
+ *
+ * @param[in,out]   wb  The write batch, must not be @c NULL.
+ * @param[in]       buf The source memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to copy from the source memory to
+ *                      the ring buffer.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid.
+ */
+extern size_t RingBufferSpscWriteBatch_writeBytes(RingBufferSpscWriteBatch *wb,
+                                                  const void *buf, size_t len);
+
+/**
+ * Publishes the bytes written through the write batch to the consumer.
+ *
+ * This is a producer function.
+ *
+ * @param[in,out]   wb  The write batch, must not be @c NULL.
+ *
+ * @return  The number of bytes published or zero if the @p wb parameter is
+ *          @c NULL.
+ */
+extern size_t RingBufferSpscWriteBatch_flush(RingBufferSpscWriteBatch *wb);
+
+/**
+ * Initializes a read batch for the SPSC ring buffer's consumer.
+ *
+ * While the batch holds unreleased bytes, the consumer must only read from the
+ * ring buffer through the batch.
+ *
+ * @param[out]      rd          The read batch, must not be @c NULL.
+ * @param[in,out]   rb          The SPSC ring buffer, must not be @c NULL.
+ * @param[in]       threshold   The number of unreleased bytes at which reads
+ *                              flush the batch, or zero to only flush it
+ *                              explicitly.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+extern bool RingBufferSpscReadBatch_initialize(RingBufferSpscReadBatch *rd,
+                                               RingBufferSpsc *rb,
+                                               size_t threshold);
+
+/**
+ * Discards bytes from the SPSC ring buffer without releasing their room to
+ * the producer until the batch is flushed.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rd  The read batch, must not be @c NULL.
+ * @param[in]       len The number of bytes to skip.
+ *
+ * @return  The number of bytes skipped or zero if a parameter is invalid.
+ */
+extern size_t RingBufferSpscReadBatch_discardBytes(RingBufferSpscReadBatch *rd,
+                                                   size_t len);
+
+/**
+ * Reads bytes from the SPSC ring buffer without releasing their room to the
+ * producer until the batch is flushed.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rd  The read batch, must not be @c NULL.
+ * @param[out]      buf The destination memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to copy from the ring buffer to the
+ *                      destination memory.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid.
+ */
+extern size_t RingBufferSpscReadBatch_readBytes(RingBufferSpscReadBatch *rd,
+                                                void *buf, size_t len);
+
+/**
+ * Releases the room of the bytes read through the read batch to the producer.
+ *
+ * This is a consumer function.
+ *
+ * @param[in,out]   rd  The read batch, must not be @c NULL.
+ *
+ * @return  The number of bytes released or zero if the @p rd parameter is
+ *          @c NULL.
+ */
+extern size_t RingBufferSpscReadBatch_flush(RingBufferSpscReadBatch *rd);
+
+#ifdef __linux__
+/**
+ * Opens the SPSC ring buffer's read and write event file descriptors.
+ *
+ * Both are non-blocking eventfd(2) file descriptors. The read event file
+ * descriptor becomes readable when the ring buffer goes from empty to
+ * non-empty and the write event file descriptor becomes readable when the ring
+ * buffer goes from full to not full, so that each side can wait for the other
+ * with @c epoll_wait() alongside other file descriptors.
+ *
+ * Opening signals each event file descriptor whose condition already holds,
+ * the read event file descriptor if the ring buffer is not empty and the write
+ * event file descriptor if it is not full, as if the edge had just happened.
+ *
+ * Signals are edge-triggered and coalesced, so a side woken by its event file
+ * descriptor acknowledges the event and then transfers bytes until the ring
+ * buffer is empty, for the consumer, or full, for the producer, before waiting
+ * again.
+ *
+ * Neither the producer nor the consumer may access the ring buffer at the same
+ * time.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL and must not
+ *                      have event file descriptors.
+ *
+ * @retval  false   The @p rb parameter is invalid or opening failed, with
+ *                  @c errno set.
+ * @retval  true    Success.
+ */
+extern bool RingBufferSpsc_openEventFds(RingBufferSpsc *rb);
+
+/**
+ * Closes the SPSC ring buffer's event file descriptors.
+ *
+ * Neither the producer nor the consumer may access the ring buffer at the same
+ * time.
+ *
+ * @param[in,out]   rb  The SPSC ring buffer, must not be @c NULL.
+ *
+ * @retval  false   The @p rb parameter is @c NULL.
+ * @retval  true    Success.
+ */
+extern bool RingBufferSpsc_closeEventFds(RingBufferSpsc *rb);
+
+/**
+ * Returns the SPSC ring buffer's read event file descriptor, for the consumer.
+ *
+ * Returns -1 if the @p rb parameter is @c NULL or the ring buffer does not
+ * have event file descriptors.
+ *
+ * @param[in]   rb  The SPSC ring buffer, must not be @c NULL.
+ */
+inline int RingBufferSpsc_getReadEventFd(const RingBufferSpsc *rb) {
+    return (rb != NULL) ? rb->_readEventFd : -1;
+}
+
+/**
+ * Returns the SPSC ring buffer's write event file descriptor, for the
+ * producer.
+ *
+ * Returns -1 if the @p rb parameter is @c NULL or the ring buffer does not
+ * have event file descriptors.
+ *
+ * @param[in]   rb  The SPSC ring buffer, must not be @c NULL.
+ */
+inline int RingBufferSpsc_getWriteEventFd(const RingBufferSpsc *rb) {
+    return (rb != NULL) ? rb->_writeEventFd : -1;
+}
+
+/**
+ * Acknowledges the events signaled on an SPSC ring buffer's event file
+ * descriptor, making it unreadable until the next signal.
+ *
+ * @param[in]   fd  The event file descriptor.
+ *
+ * @retval  false   No event was signaled or the @p fd parameter is invalid.
+ * @retval  true    At least one event was signaled.
+ */
+extern bool RingBufferSpsc_acknowledgeEvent(int fd);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _RINGBUFFERSPSC_H
@@ -0,0 +1,289 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Declares RingBufferStream and associated functions.
+ *
+ * The functions are not thread safe.
+ */
+
+#ifndef _RINGBUFFERSTREAM_H
+#define _RINGBUFFERSTREAM_H
+
+#include "RingBuffer.h"
+#include "RingBufferConfig.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A ring buffer addressed by stream offsets.
+ *
+ * Wraps a RingBuffer and numbers every byte written with its 64-bit stream
+ * offset, which increases monotonically from zero and never resets. The ring
+ * buffer keeps two read cursors: the deliver offset, up to which bytes have
+ * been read, and the acknowledge offset, up to which bytes have been released.
+ * Delivered bytes stay in the ring buffer, available to peek at by offset, for
+ * example to retransmit them, until they are acknowledged.
+ *
+ * The ring buffer holds the bytes from the acknowledge offset up to the write
+ * offset, and the deliver offset lies between the two.
+ */
+typedef struct {
+    RingBuffer _rb;
+    uint64_t _ack;
+    uint64_t _dlv;
+} RingBufferStream;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Initializes the stream ring buffer.
+ *
+ * @param[out]      rb      The stream ring buffer, must not be @c NULL.
+ * @param[in,out]   data    The data memory, or external memory for storing the
+ *                          data, must not be @c NULL.
+ * @param[in]       cap     The data memory capacity in bytes, must not be zero.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+RINGBUFFER_INLINE bool RingBufferStream_initialize(RingBufferStream *rb,
+                                                   void *data, size_t cap) {
+    if ((rb == NULL) || !RingBuffer_initialize(&rb->_rb, data, cap)) {
+        return false;
+    }
+    rb->_ack = 0;
+    rb->_dlv = 0;
+    return true;
+}
+
+/**
+ * Resets the stream ring buffer, restarting its stream offsets from zero.
+ *
+ * @param[in,out]   rb  The stream ring buffer, must not be @c NULL.
+ *
+ * @retval  false   The @p rb parameter is @c NULL.
+ * @retval  true    Success.
+ */
+RINGBUFFER_INLINE bool RingBufferStream_reset(RingBufferStream *rb) {
+    if (rb == NULL) {
+        return false;
+    }
+    RingBuffer_reset(&rb->_rb);
+    rb->_ack = 0;
+    rb->_dlv = 0;
+    return true;
+}
+
+/**
+ * Returns the stream ring buffer's data memory capacity in bytes.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The stream ring buffer, must not be @c NULL.
+ */
+RINGBUFFER_INLINE size_t
+RingBufferStream_getByteCapacity(const RingBufferStream *rb) {
+    return (rb != NULL) ? RingBuffer_getByteCapacity(&rb->_rb) : 0;
+}
+
+/**
+ * Returns the number of bytes that can be written to the stream ring buffer
+ * before the oldest unacknowledged byte would be overwritten.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The stream ring buffer, must not be @c NULL.
+ */
+RINGBUFFER_INLINE size_t
+RingBufferStream_getWriteByteCapacity(const RingBufferStream *rb) {
+    return (rb != NULL) ? RingBuffer_getWriteByteCapacity(&rb->_rb) : 0;
+}
+
+/**
+ * Returns the number of bytes written to the stream ring buffer but not yet
+ * delivered.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The stream ring buffer, must not be @c NULL.
+ */
+RINGBUFFER_INLINE size_t
+RingBufferStream_getDeliverByteCapacity(const RingBufferStream *rb) {
+    return (rb != NULL) ? (size_t)(rb->_ack +
+                                   RingBuffer_getReadByteCapacity(&rb->_rb) -
+                                   rb->_dlv)
+                        : 0;
+}
+
+/**
+ * Returns the stream ring buffer's write offset, that is, the stream offset of
+ * the next byte to be written and the total number of bytes written.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The stream ring buffer, must not be @c NULL.
+ */
+RINGBUFFER_INLINE uint64_t
+RingBufferStream_getWriteOffset(const RingBufferStream *rb) {
+    return (rb != NULL) ? (rb->_ack + RingBuffer_getReadByteCapacity(&rb->_rb))
+                        : 0;
+}
+
+/**
+ * Returns the stream ring buffer's deliver offset, that is, the stream offset
+ * of the next byte to be delivered.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The stream ring buffer, must not be @c NULL.
+ */
+RINGBUFFER_INLINE uint64_t
+RingBufferStream_getDeliverOffset(const RingBufferStream *rb) {
+    return (rb != NULL) ? rb->_dlv : 0;
+}
+
+/**
+ * Returns the stream ring buffer's acknowledge offset, that is, the stream
+ * offset of the oldest byte still held.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The stream ring buffer, must not be @c NULL.
+ */
+RINGBUFFER_INLINE uint64_t
+RingBufferStream_getAcknowledgeOffset(const RingBufferStream *rb) {
+    return (rb != NULL) ? rb->_ack : 0;
+}
+
+/**
+ * Writes bytes to the stream ring buffer at its write offset.
+ *
+ * @param[in,out]   rb  The stream ring buffer, must not be @c NULL.
+ * @param[in]       buf The source memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to copy from the source memory to
+ *                      the ring buffer.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid.
+ */
+RINGBUFFER_EXTERN size_t RingBufferStream_writeBytes(RingBufferStream *rb,
+                                                     const void *buf,
+                                                     size_t len);
+
+/**
+ * Delivers bytes from the stream ring buffer at its deliver offset.
+ *
+ * Copies the bytes and advances the deliver offset past them, but keeps them
+ * in the ring buffer until they are acknowledged.
+ *
+ * @param[in,out]   rb  The stream ring buffer, must not be @c NULL.
+ * @param[out]      buf The destination memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to copy from the ring buffer to the
+ *                      destination memory.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid.
+ */
+RINGBUFFER_EXTERN size_t RingBufferStream_deliverBytes(RingBufferStream *rb,
+                                                       void *buf, size_t len);
+
+/**
+ * Peeks bytes from the stream ring buffer at a stream offset.
+ *
+ * The stream offset must lie from the acknowledge offset up to the write
+ * offset.
+ *
+ * @param[in]   rb  The stream ring buffer, must not be @c NULL.
+ * @param[in]   off The stream offset of the first byte to peek.
+ * @param[out]  buf The destination memory, must not be @c NULL.
+ * @param[in]   len The number of bytes to peek.
+ *
+ * @return  The number of bytes copied to the destination buffer or zero if a
+ *          parameter is invalid.
+ */
+RINGBUFFER_EXTERN size_t
+RingBufferStream_peekBytesAt(const RingBufferStream *rb, uint64_t off,
+                             void *buf, size_t len);
+
+/**
+ * Peeks bytes in place in the stream ring buffer at a stream offset.
+ *
+ * The stream offset must lie from the acknowledge offset up to the write
+ * offset. See RingBuffer_peekSegmentsAt() for the regions returned.
+ *
+ * @param[in]   rb  The stream ring buffer, must not be @c NULL.
+ * @param[in]   off The stream offset of the first byte to peek.
+ * @param[out]  seg The two regions holding the bytes, must not be @c NULL.
+ * @param[in]   len The number of bytes to peek.
+ *
+ * @return  The number of bytes in the regions or zero if a parameter is
+ *          invalid.
+ */
+RINGBUFFER_EXTERN size_t
+RingBufferStream_peekSegmentsAt(const RingBufferStream *rb, uint64_t off,
+                                RingBufferSegment seg[2], size_t len);
+
+/**
+ * Moves the stream ring buffer's deliver offset back, or forward, to a stream
+ * offset, for example to deliver bytes again.
+ *
+ * The stream offset must lie from the acknowledge offset up to the write
+ * offset.
+ *
+ * @param[in,out]   rb  The stream ring buffer, must not be @c NULL.
+ * @param[in]       off The new deliver offset.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+RINGBUFFER_EXTERN bool RingBufferStream_rewind(RingBufferStream *rb,
+                                               uint64_t off);
+
+/**
+ * Acknowledges the bytes of the stream ring buffer before a stream offset,
+ * releasing their memory for writing.
+ *
+ * The stream offset must lie from the acknowledge offset up to the deliver
+ * offset.
+ *
+ * @param[in,out]   rb  The stream ring buffer, must not be @c NULL.
+ * @param[in]       off The new acknowledge offset.
+ *
+ * @return  The number of bytes released or zero if a parameter is invalid.
+ */
+RINGBUFFER_EXTERN size_t RingBufferStream_acknowledge(RingBufferStream *rb,
+                                                      uint64_t off);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifdef RINGBUFFER_HEADER_ONLY
+#include "../src/RingBufferStream.c"
+#endif
+
+#endif // _RINGBUFFERSTREAM_H
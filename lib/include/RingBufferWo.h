@@ -32,6 +32,7 @@ SOFTWARE.
 #ifndef _RINGBUFFERWO_H
 #define _RINGBUFFERWO_H
 
+#include "RingBufferConfig.h"
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -46,6 +47,7 @@ SOFTWARE.
 typedef struct {
     uint8_t *_data;
     size_t _cap;
+    size_t _mask;
     size_t _wpos;
 } RingBufferWo;
 
@@ -56,6 +58,9 @@ extern "C" {
 /**
  * Initializes the writeBytes-only ring buffer.
  *
+ * A power-of-two capacity lets the ring buffer wrap its write position with a
+ * mask instead of comparisons and a division.
+ *
  * @param[out]      rb      The writeBytes-only ring buffer, must not be @c
  *                          NULL.
  * @param[in,out]   data    The data memory, or external memory for storing the
@@ -65,12 +70,14 @@ extern "C" {
  * @retval  false   A parameter is invalid.
  * @retval  true    Success.
  */
-inline bool RingBufferWo_initialize(RingBufferWo *rb, void *data, size_t cap) {
+RINGBUFFER_INLINE bool RingBufferWo_initialize(RingBufferWo *rb, void *data,
+                                               size_t cap) {
     if ((rb == NULL) || (data == NULL) || (cap == 0)) {
         return false;
     }
     rb->_data = (uint8_t *)data;
     rb->_cap = cap;
+    rb->_mask = ((cap & (cap - 1)) == 0) ? (cap - 1) : 0;
     rb->_wpos = 0;
     return true;
 }
@@ -83,8 +90,8 @@ inline bool RingBufferWo_initialize(RingBufferWo *rb, void *data, size_t cap) {
  * @retval  false   The @p rb parameter is @c NULL.
  * @retval  true    Success.
  */
-inline bool RingBufferWo_reset(RingBufferWo *rb) {
-    if (rb == NULL) {
+RINGBUFFER_INLINE bool RingBufferWo_reset(RingBufferWo *rb) {
+    if (RINGBUFFER_ISNULL(rb)) {
         return false;
     }
     rb->_wpos = 0;
@@ -98,8 +105,8 @@ inline bool RingBufferWo_reset(RingBufferWo *rb) {
  *
  * @param[in]   rb  The write-only ring buffer, must not be @c NULL.
  */
-inline void *RingBufferWo_getDataPointer(const RingBufferWo *rb) {
-    return (rb != NULL) ? rb->_data : NULL;
+RINGBUFFER_INLINE void *RingBufferWo_getDataPointer(const RingBufferWo *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? rb->_data : NULL;
 }
 
 /**
@@ -109,8 +116,8 @@ inline void *RingBufferWo_getDataPointer(const RingBufferWo *rb) {
  *
  * @param[in]   rb  The write-only ring buffer, must not be @c NULL.
  */
-inline size_t RingBufferWo_getByteCapacity(const RingBufferWo *rb) {
-    return (rb != NULL) ? rb->_cap : 0;
+RINGBUFFER_INLINE size_t RingBufferWo_getByteCapacity(const RingBufferWo *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? rb->_cap : 0;
 }
 
 /**
@@ -120,8 +127,9 @@ inline size_t RingBufferWo_getByteCapacity(const RingBufferWo *rb) {
  *
  * @param[in]   rb  The write-only ring buffer, must not be @c NULL.
  */
-inline size_t RingBufferWo_getWriteBytePosition(const RingBufferWo *rb) {
-    return (rb != NULL) ? rb->_wpos : 0;
+RINGBUFFER_INLINE size_t
+RingBufferWo_getWriteBytePosition(const RingBufferWo *rb) {
+    return !RINGBUFFER_ISNULL(rb) ? rb->_wpos : 0;
 }
 
 /**
@@ -134,11 +142,15 @@ inline size_t RingBufferWo_getWriteBytePosition(const RingBufferWo *rb) {
  *
  * @return  The number of bytes copied or zero if a parameter is invalid.
  */
-extern size_t RingBufferWo_writeBytes(RingBufferWo *rb, const void *buf,
-                                      size_t len);
+RINGBUFFER_EXTERN size_t RingBufferWo_writeBytes(RingBufferWo *rb,
+                                                 const void *buf, size_t len);
 
 #ifdef __cplusplus
 }
 #endif
 
-#endif // _RINGBUFFERWO_H
\ No newline at end of file
+#ifdef RINGBUFFER_HEADER_ONLY
+#include "../src/RingBufferWo.c"
+#endif
+
+#endif // _RINGBUFFERWO_H
@@ -0,0 +1,164 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Declares RingBufferWoSeq and associated functions.
+ *
+ * The functions are thread safe for one writer thread and any number of reader
+ * threads. Functions documented as writer functions must only be called by the
+ * writer thread, and functions documented as reader functions may be called by
+ * any reader thread. The other functions are not thread safe.
+ */
+
+#ifndef _RINGBUFFERWOSEQ_H
+#define _RINGBUFFERWOSEQ_H
+
+#include "RingBufferWo.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * A write-only ring buffer with sequenced concurrent readers.
+ *
+ * Wraps a RingBufferWo, which overwrites old data unconditionally, and
+ * publishes the total number of bytes written as a 64-bit write sequence, in
+ * the manner of a sequence lock. Before writing, the writer publishes the
+ * write sequence that the write will reach, and after writing, it publishes the
+ * new write sequence. A reader copies a range of bytes identified by their
+ * write sequences and then checks that the writer has not started overwriting
+ * them in the meantime, retrying with the bytes that are left if it has. The
+ * writer never waits on the readers.
+ */
+typedef struct {
+    RingBufferWo _wo;
+    _Atomic uint64_t _seq;
+    _Atomic uint64_t _pend;
+} RingBufferWoSeq;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Initializes the sequenced write-only ring buffer.
+ *
+ * @param[out]      rb      The sequenced write-only ring buffer, must not be
+ *                          @c NULL.
+ * @param[in,out]   data    The data memory, or external memory for storing the
+ *                          data, must not be @c NULL.
+ * @param[in]       cap     The data memory capacity in bytes, must not be zero.
+ *
+ * @retval  false   A parameter is invalid.
+ * @retval  true    Success.
+ */
+RINGBUFFER_INLINE bool RingBufferWoSeq_initialize(RingBufferWoSeq *rb,
+                                                  void *data, size_t cap) {
+    if ((rb == NULL) || !RingBufferWo_initialize(&rb->_wo, data, cap)) {
+        return false;
+    }
+    atomic_init(&rb->_seq, 0);
+    atomic_init(&rb->_pend, 0);
+    return true;
+}
+
+/**
+ * Returns the sequenced write-only ring buffer's data memory capacity in bytes.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The sequenced write-only ring buffer, must not be @c NULL.
+ */
+RINGBUFFER_INLINE size_t
+RingBufferWoSeq_getByteCapacity(const RingBufferWoSeq *rb) {
+    return (rb != NULL) ? RingBufferWo_getByteCapacity(&rb->_wo) : 0;
+}
+
+/**
+ * Returns the sequenced write-only ring buffer's write sequence, that is, the
+ * total number of bytes written.
+ *
+ * The ring buffer holds the bytes with write sequences from the write sequence
+ * less the capacity, or zero, up to the write sequence.
+ *
+ * Returns zero if the @p rb parameter is @c NULL.
+ *
+ * @param[in]   rb  The sequenced write-only ring buffer, must not be @c NULL.
+ */
+RINGBUFFER_INLINE uint64_t
+RingBufferWoSeq_getWriteSequence(RingBufferWoSeq *rb) {
+    return (rb != NULL) ? atomic_load_explicit(&rb->_seq, memory_order_acquire)
+                        : 0;
+}
+
+/**
+ * Writes data to the sequenced write-only ring buffer.
+ *
+ * This is a writer function.
+ *
+ * @param[in,out]   rb  The sequenced write-only ring buffer, must not be
+ *                      @c NULL.
+ * @param[in]       buf The source memory, must not be @c NULL.
+ * @param[in]       len The number of bytes to copy from the source memory to
+ *                      the ring buffer.
+ *
+ * @return  The number of bytes copied or zero if a parameter is invalid.
+ */
+extern size_t RingBufferWoSeq_writeBytes(RingBufferWoSeq *rb, const void *buf,
+                                         size_t len);
+
+/**
+ * Reads bytes from the sequenced write-only ring buffer by write sequence.
+ *
+ * Copies the bytes with write sequences from @p seq up to
+ * <code>seq + len</code>, or up to the write sequence if less. If the writer
+ * has overwritten the first bytes, before or during the copy, these bytes are
+ * lost, and the bytes copied to the destination memory start at write
+ * sequence <code>seq + *lost</code> instead.
+ *
+ * The copy itself races with the writer, so the bytes copied are only valid
+ * when this function says so.
+ *
+ * This is a reader function.
+ *
+ * @param[in]   rb      The sequenced write-only ring buffer, must not be
+ *                      @c NULL.
+ * @param[in]   seq     The write sequence of the first byte to read.
+ * @param[out]  buf     The destination memory, must not be @c NULL.
+ * @param[in]   len     The number of bytes to read.
+ * @param[out]  lost    The number of bytes lost, may be @c NULL.
+ *
+ * @return  The number of valid bytes copied or zero if a parameter is invalid.
+ */
+extern size_t RingBufferWoSeq_readBytesAt(RingBufferWoSeq *rb, uint64_t seq,
+                                          void *buf, size_t len,
+                                          uint64_t *lost);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _RINGBUFFERWOSEQ_H
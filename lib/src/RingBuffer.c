@@ -27,102 +27,546 @@ SOFTWARE.
  * Implements RingBuffer and associated functions.
  */
 
+#ifndef _RINGBUFFER_C
+#define _RINGBUFFER_C
+
 #include "RingBuffer.h"
-#include <string.h>
+#include "RingBufferCopy.h"
+#include "RingBufferWrap.h"
+
+#ifndef RINGBUFFER_HEADER_ONLY
+extern inline bool RingBuffer_initialize(RingBuffer *rb, void *data,
+                                         size_t cap);
+extern inline bool RingBuffer_reset(RingBuffer *rb);
+extern inline void *RingBuffer_getDataPointer(const RingBuffer *rb);
+extern inline size_t RingBuffer_getByteCapacity(const RingBuffer *rb);
+extern inline size_t RingBuffer_getWriteByteCapacity(const RingBuffer *rb);
+extern inline size_t RingBuffer_getReadByteCapacity(const RingBuffer *rb);
+extern inline bool RingBuffer_isEmpty(const RingBuffer *rb);
+extern inline bool RingBuffer_isFull(const RingBuffer *rb);
+extern inline size_t RingBuffer_getWriteBytePosition(const RingBuffer *rb);
+extern inline size_t RingBuffer_getReadBytePosition(const RingBuffer *rb);
+extern inline bool RingBuffer_setStreamingThreshold(RingBuffer *rb,
+                                                    size_t len);
+extern inline bool RingBuffer_setPrefetchThreshold(RingBuffer *rb, size_t len);
+extern inline bool RingBuffer_setReclaimer(RingBuffer *rb,
+                                           RingBufferReclaimer reclaim,
+                                           size_t threshold);
+extern inline size_t RingBuffer_abortBytes(RingBuffer *rb);
+extern inline size_t RingBuffer_consumeBytes(RingBuffer *rb, size_t len);
+#endif
+
+// The data memory is followed by a mirror of itself.
+#define RINGBUFFER_MIRRORED 0x1u
+
+// Writes linearize the ring buffer instead of wrapping.
+#define RINGBUFFER_LINEARIZE 0x2u
+
+// The size of the scratch area of RingBuffer_linearize().
+#define RINGBUFFER_SCRATCH_SIZE 256
+
+// The largest capacity of a growable ring buffer whose allocator has no
+// maximum capacity, half the size of the largest object.
+#define RINGBUFFER_GROW_MAX ((size_t)PTRDIFF_MAX / 2 + 1)
+
+// The number of drains in a row with low occupancy after which a growable
+// ring buffer shrinks.
+#define RINGBUFFER_SHRINK_DRAINS 8
+
+// Moves the readable bytes of the growable ring buffer to the start of new data
+// memory of the capacity, which must hold them.
+static bool resize(RingBuffer *rb, size_t cap) {
+    const RingBufferAllocator *alloc = rb->_alloc;
+    uint8_t *data = (uint8_t *)alloc->allocate(alloc->ctx, cap);
+    if (data == NULL) {
+        return false;
+    }
+    RingBuffer_peekBytes(rb, data, rb->_len);
+    alloc->deallocate(alloc->ctx, rb->_data, rb->_cap);
+    rb->_data = data;
+    rb->_cap = cap;
+    rb->_mask = ((cap & (cap - 1)) == 0) ? (cap - 1) : 0;
+    rb->_rpos = 0;
+    rb->_wpos = (rb->_len < cap) ? rb->_len : 0;
+    rb->_peak = rb->_len;
+    rb->_drains = 0;
+    rb->_hot = rb->_len;
+    return true;
+}
+
+// Grows the growable ring buffer if len more bytes do not fit, and records the
+// peak occupancy. A write needs all of its bytes, so the capacity doubles as
+// often as needed, while the length of a reservation is only an upper bound,
+// so the capacity doubles at most once. Either way, the capacity stays within
+// the allocator's maximum capacity, or RINGBUFFER_GROW_MAX without one.
+static void grow(RingBuffer *rb, size_t len, bool once) {
+    size_t max =
+        (rb->_alloc->maxCap != 0) ? rb->_alloc->maxCap : RINGBUFFER_GROW_MAX;
+    size_t need = (len < (SIZE_MAX - rb->_len)) ? (rb->_len + len) : SIZE_MAX;
+    if ((need > rb->_cap) && (rb->_cap < max)) {
+        size_t cap = rb->_cap;
+        do {
+            cap = (cap <= (max / 2)) ? (cap * 2) : max;
+        } while (!once && (cap < need) && (cap < max));
+        rb->_resv = 0;
+        resize(rb, cap);
+    }
+    if (need > rb->_cap) {
+        need = rb->_cap;
+    }
+    if (need > rb->_peak) {
+        rb->_peak = need;
+    }
+}
+
+// Resets the positions of the drained ring buffer, shrinks it after enough
+// drains in a row with low occupancy if it is growable, and releases its idle
+// data memory if enough of it may be resident.
+static void drained(RingBuffer *rb) {
+    rb->_wpos = 0;
+    rb->_rpos = 0;
+    if (rb->_alloc != NULL) {
+        if ((rb->_peak > (rb->_cap / 4)) ||
+            (rb->_cap <= rb->_alloc->minCap)) {
+            rb->_drains = 0;
+        } else if (++rb->_drains >= RINGBUFFER_SHRINK_DRAINS) {
+            size_t cap = rb->_cap / 2;
+            resize(rb, (cap > rb->_alloc->minCap) ? cap : rb->_alloc->minCap);
+        }
+        rb->_peak = 0;
+    }
+    if ((rb->_rcmin != 0) && (rb->_hot >= rb->_rcmin)) {
+        RingBuffer_reclaimMemory(rb);
+    }
+}
+
+// Records that len bytes from the write position are about to be written, so
+// that the data memory beyond the furthest of them is known to be cold.
+static void touch(RingBuffer *rb, size_t len) {
+    size_t end = rb->_wpos + len;
+    if (end > rb->_hot) {
+        rb->_hot = (end < rb->_cap) ? end : rb->_cap;
+    }
+}
+
+// Releases the data memory from offset start to offset end, short of the cold
+// data memory.
+static size_t reclaimRange(RingBuffer *rb, size_t start, size_t end) {
+    if (end > rb->_hot) {
+        end = rb->_hot;
+    }
+    if (start >= end) {
+        return 0;
+    }
+    return rb->_reclaim(rb->_data + start, end - start,
+                        (rb->_flags & RINGBUFFER_MIRRORED) != 0);
+}
+
+// Fills the segments with the len bytes at the data memory offset, which only
+// wrap around the end of the data memory if it is not mirrored.
+static void splitSegments(const RingBuffer *rb, size_t off, size_t len,
+                          RingBufferSegment seg[2]) {
+    size_t end = (rb->_flags & RINGBUFFER_MIRRORED) ? (2 * rb->_cap) : rb->_cap;
+    RingBufferWrap_segments(rb->_data, end, off, len, seg);
+}
+
+// The power-of-two implementations below wrap positions with the mask and
+// copy across the end of the data memory in two pieces, the second of which
+// is usually empty, instead of comparing positions with the capacity.
+
+static size_t writeBytesPow2(RingBuffer *rb, const uint8_t *tbuf, size_t len) {
+    size_t first = rb->_cap - rb->_wpos;
+    if ((rb->_flags & RINGBUFFER_MIRRORED) || (len < first)) {
+        first = len;
+    }
+    RingBufferCopy_copy(rb->_data + rb->_wpos, tbuf, first);
+    if (len > first) {
+        RingBufferCopy_copy(rb->_data, tbuf + first, len - first);
+    }
+    rb->_wpos = (rb->_wpos + len) & rb->_mask;
+    rb->_len += len;
+    return len;
+}
+
+static size_t discardBytesPow2(RingBuffer *rb, size_t len) {
+    rb->_len -= len;
+    if ((rb->_len == 0) && (rb->_resv == 0)) {
+        drained(rb);
+    } else {
+        rb->_rpos = (rb->_rpos + len) & rb->_mask;
+    }
+    return len;
+}
+
+static size_t peekBytesPow2(const RingBuffer *rb, size_t pos, uint8_t *tbuf,
+                            size_t len) {
+    size_t rpos = (rb->_rpos + pos) & rb->_mask;
+    size_t first = rb->_cap - rpos;
+    if ((rb->_flags & RINGBUFFER_MIRRORED) || (len < first)) {
+        first = len;
+    }
+    RingBufferCopy_copy(tbuf, rb->_data + rpos, first);
+    if (len > first) {
+        RingBufferCopy_copy(tbuf + first, rb->_data, len - first);
+    }
+    return len;
+}
+
+static size_t readBytesPow2(RingBuffer *rb, uint8_t *tbuf, size_t len) {
+    peekBytesPow2(rb, 0, tbuf, len);
+    return discardBytesPow2(rb, len);
+}
+
+// Fills the bytes with non-temporal stores and fences the stores before
+// publishing the bytes.
+static size_t writeBytesStreaming(RingBuffer *rb, const uint8_t *tbuf,
+                                  size_t len) {
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    splitSegments(rb, rb->_wpos, len, seg);
+    RingBufferCopy_stream(seg[0].data, tbuf, seg[0].len);
+    RingBufferCopy_stream(seg[1].data, tbuf + seg[0].len, seg[1].len);
+    RingBufferCopy_fence();
+    rb->_wpos += len;
+    if (rb->_wpos >= rb->_cap) {
+        rb->_wpos -= rb->_cap;
+    }
+    rb->_len += len;
+    return len;
+}
+
+// Prefetches the segment that wraps to the start of the data memory, which the
+// hardware prefetcher cannot predict, while copying the first one.
+static size_t peekBytesPrefetch(const RingBuffer *rb, size_t pos, uint8_t *tbuf,
+                                size_t len) {
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    len = RingBuffer_peekSegmentsAt(rb, pos, seg, len);
+    RingBufferCopy_prefetch(seg[1].data, seg[1].len);
+    RingBufferCopy_copy(tbuf, seg[0].data, seg[0].len);
+    RingBufferCopy_copy(tbuf + seg[0].len, seg[1].data, seg[1].len);
+    return len;
+}
+
+// Also prefetches the bytes that the next read is likely to copy.
+static size_t readBytesPrefetch(RingBuffer *rb, uint8_t *tbuf, size_t len) {
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    len = RingBuffer_discardBytes(rb, peekBytesPrefetch(rb, 0, tbuf, len));
+    if (RingBuffer_peekSegments(rb, seg, len) > 0) {
+        RingBufferCopy_prefetch(seg[0].data, seg[0].len);
+    }
+    return len;
+}
+
+// Swaps the len bytes at a with the len bytes at b, which must not overlap,
+// through the scratch area.
+static void swapBytes(uint8_t *a, uint8_t *b, size_t len, uint8_t *scratch) {
+    while (len > 0) {
+        size_t n =
+            (len < RINGBUFFER_SCRATCH_SIZE) ? len : RINGBUFFER_SCRATCH_SIZE;
+        RingBufferCopy_copy(scratch, a, n);
+        RingBufferCopy_copy(a, b, n);
+        RingBufferCopy_copy(b, scratch, n);
+        a += n;
+        b += n;
+        len -= n;
+    }
+}
+
+// Rotates the len bytes at data left by k bytes with the Gries-Mills block swap
+// algorithm, each step of which moves the smaller block into its final place
+// with one sequential pass, until the smaller block fits in the scratch area.
+static void rotateBytes(uint8_t *data, size_t len, size_t k) {
+    uint8_t scratch[RINGBUFFER_SCRATCH_SIZE];
+    while ((k != 0) && (k != len)) {
+        size_t m = len - k;
+        if (k <= RINGBUFFER_SCRATCH_SIZE) {
+            RingBufferCopy_copy(scratch, data, k);
+            memmove(data, data + k, m);
+            RingBufferCopy_copy(data + m, scratch, k);
+            return;
+        }
+        if (m <= RINGBUFFER_SCRATCH_SIZE) {
+            RingBufferCopy_copy(scratch, data + k, m);
+            memmove(data + m, data, k);
+            RingBufferCopy_copy(data, scratch, m);
+            return;
+        }
+        if (k <= m) {
+            swapBytes(data, data + k, k, scratch);
+            data += k;
+            len -= k;
+        } else {
+            swapBytes(data, data + k, m, scratch);
+            data += m;
+            len -= m;
+            k -= m;
+        }
+    }
+}
+
+bool RingBuffer_initializeMirrored(RingBuffer *rb, void *data, size_t cap) {
+    if (!RingBuffer_initialize(rb, data, cap)) {
+        return false;
+    }
+    rb->_flags |= RINGBUFFER_MIRRORED;
+    return true;
+}
+
+bool RingBuffer_initializeGrowable(RingBuffer *rb,
+                                   const RingBufferAllocator *alloc) {
+    if ((rb == NULL) || (alloc == NULL) || (alloc->allocate == NULL) ||
+        (alloc->deallocate == NULL) || (alloc->minCap == 0) ||
+        ((alloc->maxCap != 0) && (alloc->maxCap < alloc->minCap))) {
+        return false;
+    }
+    void *data = alloc->allocate(alloc->ctx, alloc->minCap);
+    if (!RingBuffer_initialize(rb, data, alloc->minCap)) {
+        return false;
+    }
+    rb->_alloc = alloc;
+    return true;
+}
+
+bool RingBuffer_freeMemory(RingBuffer *rb) {
+    if (RINGBUFFER_ISNULL(rb) || (rb->_alloc == NULL)) {
+        return false;
+    }
+    rb->_alloc->deallocate(rb->_alloc->ctx, rb->_data, rb->_cap);
+    rb->_data = NULL;
+    rb->_cap = 0;
+    rb->_len = 0;
+    rb->_alloc = NULL;
+    return true;
+}
+
+bool RingBuffer_ensureWriteByteCapacity(RingBuffer *rb, size_t len) {
+    if (RINGBUFFER_ISNULL(rb)) {
+        return false;
+    }
+    if ((rb->_alloc != NULL) && (len > 0)) {
+        grow(rb, len, false);
+    }
+    return len <= (rb->_cap - rb->_len);
+}
 
 size_t RingBuffer_getWriteByteSpan(const RingBuffer *rb) {
-    if (rb == NULL) {
+    if (RINGBUFFER_ISNULL(rb)) {
         return 0;
     }
     size_t wcap = rb->_cap - rb->_len;
-    if ((rb->_wpos + wcap) >= rb->_cap) {
+    if (!(rb->_flags & RINGBUFFER_MIRRORED) &&
+        ((rb->_wpos + wcap) >= rb->_cap)) {
         return rb->_cap - rb->_wpos;
     }
     return wcap;
 }
 
 size_t RingBuffer_getReadByteSpan(const RingBuffer *rb) {
-    if (rb == NULL) {
+    if (RINGBUFFER_ISNULL(rb)) {
         return 0;
     }
-    if ((rb->_rpos + rb->_len) >= rb->_cap) {
+    if (!(rb->_flags & RINGBUFFER_MIRRORED) &&
+        ((rb->_rpos + rb->_len) >= rb->_cap)) {
         return rb->_cap - rb->_rpos;
     }
     return rb->_len;
 }
 
+size_t RingBuffer_linearize(RingBuffer *rb) {
+    if (RINGBUFFER_ISNULL(rb) || (rb->_resv != 0)) {
+        return 0;
+    }
+    if ((rb->_rpos == 0) || (rb->_flags & RINGBUFFER_MIRRORED)) {
+        return rb->_len;
+    }
+    size_t first = rb->_cap - rb->_rpos;
+    if (rb->_len <= first) {
+        memmove(rb->_data, rb->_data + rb->_rpos, rb->_len);
+    } else {
+        // Closes the gap between the two pieces, then rotates them.
+        size_t second = rb->_len - first;
+        memmove(rb->_data + second, rb->_data + rb->_rpos, first);
+        rotateBytes(rb->_data, rb->_len, second);
+    }
+    rb->_rpos = 0;
+    rb->_wpos = (rb->_len < rb->_cap) ? rb->_len : 0;
+    return rb->_len;
+}
+
+size_t RingBuffer_reclaimMemory(RingBuffer *rb) {
+    if (RINGBUFFER_ISNULL(rb) || (rb->_reclaim == NULL)) {
+        return 0;
+    }
+    size_t used = rb->_len + rb->_resv;
+    if (used == 0) {
+        size_t len = reclaimRange(rb, 0, rb->_cap);
+        rb->_hot = 0;
+        return len;
+    }
+    // The idle bytes follow the reserved bytes up to the read position.
+    size_t start = rb->_wpos + rb->_resv;
+    if (start >= rb->_cap) {
+        start -= rb->_cap;
+    }
+    size_t end = start + (rb->_cap - used);
+    if (end <= rb->_cap) {
+        return reclaimRange(rb, start, end);
+    }
+    return reclaimRange(rb, start, rb->_cap) +
+           reclaimRange(rb, 0, end - rb->_cap);
+}
+
+bool RingBuffer_setAutoLinearize(RingBuffer *rb, bool enable) {
+    if (RINGBUFFER_ISNULL(rb)) {
+        return false;
+    }
+    if (enable) {
+        rb->_flags |= RINGBUFFER_LINEARIZE;
+    } else {
+        rb->_flags &= ~RINGBUFFER_LINEARIZE;
+    }
+    return true;
+}
+
 size_t RingBuffer_writeBytes(RingBuffer *rb, const void *buf, size_t len) {
-    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+    if (RINGBUFFER_ISNULL(rb) || RINGBUFFER_ISNULL(buf) || (len == 0)) {
         return 0;
     }
     const uint8_t *tbuf = (uint8_t *)buf;
+    if (rb->_alloc != NULL) {
+        grow(rb, len, false);
+    }
     size_t wcap = rb->_cap - rb->_len;
     if (len > wcap) {
         len = wcap;
     }
+    if ((rb->_flags & RINGBUFFER_LINEARIZE) &&
+        ((rb->_rpos + rb->_len + len) > rb->_cap)) {
+        RingBuffer_linearize(rb);
+    }
+    touch(rb, len);
+    if ((rb->_stmin != 0) && (len >= rb->_stmin)) {
+        return writeBytesStreaming(rb, tbuf, len);
+    }
+    if (rb->_mask != 0) {
+        return writeBytesPow2(rb, tbuf, len);
+    }
     size_t left = len;
-    if ((rb->_wpos + left) >= rb->_cap) {
+    if (!(rb->_flags & RINGBUFFER_MIRRORED) &&
+        ((rb->_wpos + left) >= rb->_cap)) {
         size_t copy = rb->_cap - rb->_wpos;
-        memcpy(rb->_data + rb->_wpos, tbuf, copy);
+        RingBufferCopy_copy(rb->_data + rb->_wpos, tbuf, copy);
         rb->_wpos = 0;
         rb->_len += copy;
         tbuf += copy;
         left -= copy;
     }
     if (left > 0) {
-        memcpy(rb->_data + rb->_wpos, tbuf, left);
+        RingBufferCopy_copy(rb->_data + rb->_wpos, tbuf, left);
         rb->_wpos += left;
+        if (rb->_wpos >= rb->_cap) {
+            rb->_wpos -= rb->_cap;
+        }
         rb->_len += left;
     }
     return len;
 }
 
+size_t RingBuffer_reserveBytes(RingBuffer *rb, RingBufferSegment seg[2],
+                               size_t len) {
+    if (RINGBUFFER_ISNULL(rb) || RINGBUFFER_ISNULL(seg) || (len == 0)) {
+        return 0;
+    }
+    if (rb->_alloc != NULL) {
+        grow(rb, len, true);
+    }
+    size_t wcap = rb->_cap - rb->_len;
+    if (len > wcap) {
+        len = wcap;
+    }
+    if ((rb->_flags & RINGBUFFER_LINEARIZE) &&
+        ((rb->_rpos + rb->_len + len) > rb->_cap)) {
+        rb->_resv = 0;
+        RingBuffer_linearize(rb);
+    }
+    touch(rb, len);
+    splitSegments(rb, rb->_wpos, len, seg);
+    rb->_resv = len;
+    return len;
+}
+
+size_t RingBuffer_commitBytes(RingBuffer *rb, size_t len) {
+    if (RINGBUFFER_ISNULL(rb) || (len == 0)) {
+        return 0;
+    }
+    if (len > rb->_resv) {
+        len = rb->_resv;
+    }
+    rb->_resv = 0;
+    rb->_wpos += len;
+    if (rb->_wpos >= rb->_cap) {
+        rb->_wpos -= rb->_cap;
+    }
+    rb->_len += len;
+    return len;
+}
+
 size_t RingBuffer_readBytes(RingBuffer *rb, void *buf, size_t len) {
-    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+    if (RINGBUFFER_ISNULL(rb) || RINGBUFFER_ISNULL(buf) || (len == 0)) {
         return 0;
     }
     if (len > rb->_len) {
         len = rb->_len;
     }
     uint8_t *tbuf = (uint8_t *)buf;
+    if ((rb->_pfmin != 0) && (len >= rb->_pfmin)) {
+        return readBytesPrefetch(rb, tbuf, len);
+    }
+    if (rb->_mask != 0) {
+        return readBytesPow2(rb, tbuf, len);
+    }
     size_t left = len;
-    if ((rb->_rpos + left) >= rb->_cap) {
+    if (!(rb->_flags & RINGBUFFER_MIRRORED) &&
+        ((rb->_rpos + left) >= rb->_cap)) {
         size_t copy = rb->_cap - rb->_rpos;
-        memcpy(tbuf, rb->_data + rb->_rpos, copy);
+        RingBufferCopy_copy(tbuf, rb->_data + rb->_rpos, copy);
         rb->_rpos = 0;
         rb->_len -= copy;
         tbuf += copy;
         left -= copy;
     }
     if (left > 0) {
-        memcpy(tbuf, rb->_data + rb->_rpos, left);
+        RingBufferCopy_copy(tbuf, rb->_data + rb->_rpos, left);
         rb->_len -= left;
     }
-    if (rb->_len == 0) {
-        rb->_wpos = 0;
-        rb->_rpos = 0;
+    if ((rb->_len == 0) && (rb->_resv == 0)) {
+        drained(rb);
     } else {
         rb->_rpos += left;
+        if (rb->_rpos >= rb->_cap) {
+            rb->_rpos -= rb->_cap;
+        }
     }
     return len;
 }
 
 size_t RingBuffer_discardBytes(RingBuffer *rb, size_t len) {
-    if ((rb == NULL) || (len == 0)) {
+    if (RINGBUFFER_ISNULL(rb) || (len == 0)) {
         return 0;
     }
     if (len > rb->_len) {
         len = rb->_len;
     }
+    if (rb->_mask != 0) {
+        return discardBytesPow2(rb, len);
+    }
     size_t left = len;
     if ((rb->_rpos + left) >= rb->_cap) {
-        rb->_rpos = 0;
         left -= rb->_cap - rb->_rpos;
+        rb->_rpos = 0;
     }
     rb->_len -= len;
-    if (rb->_len == 0) {
-        rb->_wpos = 0;
-        rb->_rpos = 0;
+    if ((rb->_len == 0) && (rb->_resv == 0)) {
+        drained(rb);
     } else {
         rb->_rpos += left;
     }
@@ -130,31 +574,38 @@ size_t RingBuffer_discardBytes(RingBuffer *rb, size_t len) {
 }
 
 size_t RingBuffer_peekBytes(const RingBuffer *rb, void *buf, size_t len) {
-    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+    if (RINGBUFFER_ISNULL(rb) || RINGBUFFER_ISNULL(buf) || (len == 0)) {
         return 0;
     }
     if (len > rb->_len) {
         len = rb->_len;
     }
     uint8_t *tbuf = (uint8_t *)buf;
+    if ((rb->_pfmin != 0) && (len >= rb->_pfmin)) {
+        return peekBytesPrefetch(rb, 0, tbuf, len);
+    }
+    if (rb->_mask != 0) {
+        return peekBytesPow2(rb, 0, tbuf, len);
+    }
     size_t left = len;
     size_t rpos = rb->_rpos;
-    if ((rpos + left) >= rb->_cap) {
+    if (!(rb->_flags & RINGBUFFER_MIRRORED) && ((rpos + left) >= rb->_cap)) {
         size_t copy = rb->_cap - rpos;
-        memcpy(tbuf, rb->_data + rpos, copy);
+        RingBufferCopy_copy(tbuf, rb->_data + rpos, copy);
         rpos = 0;
         tbuf += copy;
         left -= copy;
     }
     if (left > 0) {
-        memcpy(tbuf, rb->_data + rpos, left);
+        RingBufferCopy_copy(tbuf, rb->_data + rpos, left);
     }
     return len;
 }
 
 size_t RingBuffer_peekBytesAt(const RingBuffer *rb, size_t pos, void *buf,
                               size_t len) {
-    if ((rb == NULL) || (pos >= rb->_len) || (buf == NULL) || (len == 0)) {
+    if (RINGBUFFER_ISNULL(rb) || (pos >= rb->_len) || RINGBUFFER_ISNULL(buf) ||
+        (len == 0)) {
         return 0;
     }
     uint8_t *tbuf = (uint8_t *)buf;
@@ -162,20 +613,51 @@ size_t RingBuffer_peekBytesAt(const RingBuffer *rb, size_t pos, void *buf,
     if (len > rcap) {
         len = rcap;
     }
+    if ((rb->_pfmin != 0) && (len >= rb->_pfmin)) {
+        return peekBytesPrefetch(rb, pos, tbuf, len);
+    }
+    if (rb->_mask != 0) {
+        return peekBytesPow2(rb, pos, tbuf, len);
+    }
     size_t left = len;
     size_t rpos = rb->_rpos + pos;
     if (rpos >= rb->_cap) {
         rpos -= rb->_cap;
     }
-    if ((rpos + left) >= rb->_cap) {
+    if (!(rb->_flags & RINGBUFFER_MIRRORED) && ((rpos + left) >= rb->_cap)) {
         size_t copy = rb->_cap - rpos;
-        memcpy(tbuf, rb->_data + rpos, copy);
+        RingBufferCopy_copy(tbuf, rb->_data + rpos, copy);
         rpos = 0;
         tbuf += copy;
         left -= copy;
     }
     if (left > 0) {
-        memcpy(tbuf, rb->_data + rpos, left);
+        RingBufferCopy_copy(tbuf, rb->_data + rpos, left);
+    }
+    return len;
+}
+
+size_t RingBuffer_peekSegments(const RingBuffer *rb, RingBufferSegment seg[2],
+                               size_t len) {
+    return RingBuffer_peekSegmentsAt(rb, 0, seg, len);
+}
+
+size_t RingBuffer_peekSegmentsAt(const RingBuffer *rb, size_t pos,
+                                 RingBufferSegment seg[2], size_t len) {
+    if (RINGBUFFER_ISNULL(rb) || (pos >= rb->_len) || RINGBUFFER_ISNULL(seg) ||
+        (len == 0)) {
+        return 0;
     }
+    size_t rcap = rb->_len - pos;
+    if (len > rcap) {
+        len = rcap;
+    }
+    size_t rpos = rb->_rpos + pos;
+    if (rpos >= rb->_cap) {
+        rpos -= rb->_cap;
+    }
+    splitSegments(rb, rpos, len, seg);
     return len;
 }
+
+#endif // _RINGBUFFER_C
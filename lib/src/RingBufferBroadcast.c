@@ -0,0 +1,190 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Implements RingBufferBroadcast and associated functions.
+ */
+
+#include "RingBufferBroadcast.h"
+#include "RingBufferWrap.h"
+#include <string.h>
+
+extern inline void
+*RingBufferBroadcast_getDataPointer(const RingBufferBroadcast *rb);
+extern inline size_t
+RingBufferBroadcast_getByteCapacity(const RingBufferBroadcast *rb);
+extern inline size_t
+RingBufferBroadcast_getReaderCount(const RingBufferBroadcast *rb);
+
+// Returns the producer's write capacity, only loading the consumers' read
+// indices if the cached copy of the slowest one does not leave room for len
+// bytes.
+static size_t writeCapacity(RingBufferBroadcast *rb, size_t wpos, size_t len) {
+    size_t wcap =
+        rb->_cap - RingBufferWrap_used(rb->_cap, wpos, rb->_rposCache);
+    if (wcap < len) {
+        size_t most = 0;
+        for (size_t i = 0; i < rb->_count; ++i) {
+            size_t rpos = atomic_load_explicit(&rb->_readers[i]._rpos,
+                                               memory_order_acquire);
+            if (RingBufferWrap_used(rb->_cap, wpos, rpos) >= most) {
+                most = RingBufferWrap_used(rb->_cap, wpos, rpos);
+                rb->_rposCache = rpos;
+            }
+        }
+        wcap = rb->_cap - most;
+    }
+    return wcap;
+}
+
+// Returns the consumer's read capacity, only loading the producer's write index
+// if the cached copy does not hold len bytes.
+static size_t readCapacity(RingBufferBroadcast *rb,
+                           RingBufferBroadcastReader *reader, size_t rpos,
+                           size_t len) {
+    size_t rcap = RingBufferWrap_used(rb->_cap, reader->_wposCache, rpos);
+    if (rcap < len) {
+        reader->_wposCache =
+            atomic_load_explicit(&rb->_wpos, memory_order_acquire);
+        rcap = RingBufferWrap_used(rb->_cap, reader->_wposCache, rpos);
+    }
+    return rcap;
+}
+
+bool RingBufferBroadcast_initialize(RingBufferBroadcast *rb, void *data,
+                                    size_t cap,
+                                    RingBufferBroadcastReader *readers,
+                                    size_t count) {
+    if ((rb == NULL) || (data == NULL) || (cap == 0) ||
+        (cap > SIZE_MAX / 2) || (readers == NULL) || (count == 0)) {
+        return false;
+    }
+    rb->_data = (uint8_t *)data;
+    rb->_cap = cap;
+    rb->_readers = readers;
+    rb->_count = count;
+    atomic_init(&rb->_wpos, 0);
+    rb->_rposCache = 0;
+    for (size_t i = 0; i < count; ++i) {
+        atomic_init(&readers[i]._rpos, 0);
+        readers[i]._wposCache = 0;
+    }
+    return true;
+}
+
+size_t RingBufferBroadcast_getWriteByteCapacity(RingBufferBroadcast *rb) {
+    if (rb == NULL) {
+        return 0;
+    }
+    size_t wpos = atomic_load_explicit(&rb->_wpos, memory_order_relaxed);
+    return writeCapacity(rb, wpos, rb->_cap);
+}
+
+size_t RingBufferBroadcast_writeBytes(RingBufferBroadcast *rb,
+                                      const void *buf, size_t len) {
+    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    const uint8_t *tbuf = (const uint8_t *)buf;
+    size_t wpos = atomic_load_explicit(&rb->_wpos, memory_order_relaxed);
+    size_t wcap = writeCapacity(rb, wpos, len);
+    if (len > wcap) {
+        len = wcap;
+    }
+    size_t off = RingBufferWrap_offset(rb->_cap, wpos);
+    size_t left = len;
+    if ((off + left) > rb->_cap) {
+        size_t copy = rb->_cap - off;
+        memcpy(rb->_data + off, tbuf, copy);
+        tbuf += copy;
+        left -= copy;
+        off = 0;
+    }
+    memcpy(rb->_data + off, tbuf, left);
+    atomic_store_explicit(&rb->_wpos,
+                          RingBufferWrap_advance(rb->_cap, wpos, len),
+                          memory_order_release);
+    return len;
+}
+
+size_t RingBufferBroadcast_getReadByteCapacity(RingBufferBroadcast *rb,
+                                               size_t reader) {
+    if ((rb == NULL) || (reader >= rb->_count)) {
+        return 0;
+    }
+    RingBufferBroadcastReader *treader = &rb->_readers[reader];
+    size_t rpos = atomic_load_explicit(&treader->_rpos, memory_order_relaxed);
+    return readCapacity(rb, treader, rpos, rb->_cap);
+}
+
+size_t RingBufferBroadcast_peekSegments(RingBufferBroadcast *rb,
+                                        size_t reader,
+                                        RingBufferSegment seg[2], size_t len) {
+    if ((rb == NULL) || (reader >= rb->_count) || (seg == NULL) ||
+        (len == 0)) {
+        return 0;
+    }
+    RingBufferBroadcastReader *treader = &rb->_readers[reader];
+    size_t rpos = atomic_load_explicit(&treader->_rpos, memory_order_relaxed);
+    size_t rcap = readCapacity(rb, treader, rpos, len);
+    if (len > rcap) {
+        len = rcap;
+    }
+    RingBufferWrap_segments(rb->_data, rb->_cap,
+                            RingBufferWrap_offset(rb->_cap, rpos), len, seg);
+    return len;
+}
+
+size_t RingBufferBroadcast_consumeBytes(RingBufferBroadcast *rb,
+                                        size_t reader, size_t len) {
+    if ((rb == NULL) || (reader >= rb->_count) || (len == 0)) {
+        return 0;
+    }
+    RingBufferBroadcastReader *treader = &rb->_readers[reader];
+    size_t rpos = atomic_load_explicit(&treader->_rpos, memory_order_relaxed);
+    size_t rcap = readCapacity(rb, treader, rpos, len);
+    if (len > rcap) {
+        len = rcap;
+    }
+    atomic_store_explicit(&treader->_rpos,
+                          RingBufferWrap_advance(rb->_cap, rpos, len),
+                          memory_order_release);
+    return len;
+}
+
+size_t RingBufferBroadcast_readBytes(RingBufferBroadcast *rb, size_t reader,
+                                     void *buf, size_t len) {
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    if (buf == NULL) {
+        return 0;
+    }
+    len = RingBufferBroadcast_peekSegments(rb, reader, seg, len);
+    if (len == 0) {
+        return 0;
+    }
+    memcpy(buf, seg[0].data, seg[0].len);
+    memcpy((uint8_t *)buf + seg[0].len, seg[1].data, seg[1].len);
+    return RingBufferBroadcast_consumeBytes(rb, reader, len);
+}
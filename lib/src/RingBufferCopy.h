@@ -0,0 +1,254 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Defines the internal byte copy functions of RingBuffer, RingBufferRo and
+ * RingBufferWo.
+ *
+ * Ring buffer copies are mostly short and of a length known only at run time,
+ * for which the size dispatch of memcpy() costs about as much as the copy.
+ * RingBufferCopy_copy() copies up to 32 bytes with two overlapping loads and
+ * stores, and up to RINGBUFFERCOPY_VECTOR_MAX bytes with AVX-512 or AVX2
+ * vectors from both ends or, on other CPUs, 16-byte chunks, leaving longer
+ * copies to memcpy().
+ * On x86 with GCC or Clang, the CPU features come from
+ * __builtin_cpu_supports(), which reads the result of the single CPUID query
+ * that the runtime makes at startup.
+ *
+ * For large transfers, RingBufferCopy_stream() copies with non-temporal
+ * stores that bypass the caches, and RingBufferCopy_prefetch() pulls the start
+ * of a region into the cache ahead of a copy from it.
+ */
+
+#ifndef _RINGBUFFERCOPY_H
+#define _RINGBUFFERCOPY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if (defined(__GNUC__) || defined(__clang__)) &&                               \
+    (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define RINGBUFFERCOPY_X86
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define RINGBUFFERCOPY_SSE2
+#endif
+
+// Copies longer than this many bytes go to memcpy(), whose large copy paths
+// outrun the code below.
+#define RINGBUFFERCOPY_VECTOR_MAX 256
+
+#if defined(__GNUC__) || defined(__clang__)
+#define RINGBUFFERCOPY_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#define RINGBUFFERCOPY_NOINLINE __declspec(noinline)
+#else
+#define RINGBUFFERCOPY_NOINLINE
+#endif
+
+// The number of bytes at most that RingBufferCopy_prefetch() prefetches, after
+// which the hardware prefetcher has picked up the sequential access.
+#define RINGBUFFERCOPY_PREFETCH_MAX 4096
+
+// Copies len bytes, more than 16, in 16-byte chunks, the last of which
+// overlaps the one before it.
+static inline void RingBufferCopy_chunks(uint8_t *dst, const uint8_t *src,
+                                         size_t len) {
+    if (len <= 16) {
+        return;
+    }
+    size_t last = len - 16;
+    for (size_t i = 0; i < last; i += 16) {
+        memcpy(dst + i, src + i, 16);
+    }
+    memcpy(dst + last, src + last, 16);
+}
+
+#ifdef RINGBUFFERCOPY_X86
+// Copies len bytes, more than 32 and at most 256, as 32-byte vectors from the
+// head and the tail, which overlap.
+__attribute__((target("avx2"))) static inline void
+RingBufferCopy_avx2(uint8_t *dst, const uint8_t *src, size_t len) {
+    const uint8_t *tsrc = src + len - 32;
+    uint8_t *tdst = dst + len - 32;
+    __m256i h0 = _mm256_loadu_si256((const __m256i *)src);
+    __m256i t0 = _mm256_loadu_si256((const __m256i *)tsrc);
+    if (len > 64) {
+        __m256i h1 = _mm256_loadu_si256((const __m256i *)(src + 32));
+        __m256i t1 = _mm256_loadu_si256((const __m256i *)(tsrc - 32));
+        if (len > 128) {
+            __m256i h2 = _mm256_loadu_si256((const __m256i *)(src + 64));
+            __m256i h3 = _mm256_loadu_si256((const __m256i *)(src + 96));
+            __m256i t2 = _mm256_loadu_si256((const __m256i *)(tsrc - 64));
+            __m256i t3 = _mm256_loadu_si256((const __m256i *)(tsrc - 96));
+            _mm256_storeu_si256((__m256i *)(dst + 64), h2);
+            _mm256_storeu_si256((__m256i *)(dst + 96), h3);
+            _mm256_storeu_si256((__m256i *)(tdst - 64), t2);
+            _mm256_storeu_si256((__m256i *)(tdst - 96), t3);
+        }
+        _mm256_storeu_si256((__m256i *)(dst + 32), h1);
+        _mm256_storeu_si256((__m256i *)(tdst - 32), t1);
+    }
+    _mm256_storeu_si256((__m256i *)dst, h0);
+    _mm256_storeu_si256((__m256i *)tdst, t0);
+}
+
+// Copies len bytes, more than 64 and at most 256, as 64-byte vectors from the
+// head and the tail, which overlap.
+__attribute__((target("avx512f"))) static inline void
+RingBufferCopy_avx512(uint8_t *dst, const uint8_t *src, size_t len) {
+    const uint8_t *tsrc = src + len - 64;
+    uint8_t *tdst = dst + len - 64;
+    __m512i h0 = _mm512_loadu_si512(src);
+    __m512i t0 = _mm512_loadu_si512(tsrc);
+    if (len > 128) {
+        __m512i h1 = _mm512_loadu_si512(src + 64);
+        __m512i t1 = _mm512_loadu_si512(tsrc - 64);
+        _mm512_storeu_si512(dst + 64, h1);
+        _mm512_storeu_si512(tdst - 64, t1);
+    }
+    _mm512_storeu_si512(dst, h0);
+    _mm512_storeu_si512(tdst, t0);
+}
+#endif
+
+// Copies len bytes, more than 16, from src to dst, which must not overlap.
+//
+// Kept out of line so that, once a caller is inlined into code whose buffer has
+// a constant size, GCC does not warn about these paths for lengths that the
+// ring buffer positions never allow but that it cannot rule out.
+RINGBUFFERCOPY_NOINLINE static void
+RingBufferCopy_long(uint8_t *tdst, const uint8_t *tsrc, size_t len) {
+    if (len <= 32) {
+        uint8_t head[16], tail[16];
+        memcpy(head, tsrc, 16);
+        memcpy(tail, tsrc + len - 16, 16);
+        memcpy(tdst, head, 16);
+        memcpy(tdst + len - 16, tail, 16);
+        return;
+    }
+    if (len > RINGBUFFERCOPY_VECTOR_MAX) {
+        memcpy(tdst, tsrc, len);
+        return;
+    }
+#ifdef RINGBUFFERCOPY_X86
+    if ((len > 64) && __builtin_cpu_supports("avx512f")) {
+        RingBufferCopy_avx512(tdst, tsrc, len);
+        return;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        RingBufferCopy_avx2(tdst, tsrc, len);
+        return;
+    }
+#endif
+    RingBufferCopy_chunks(tdst, tsrc, len);
+}
+
+// Copies len bytes from src to dst, which must not overlap.
+static inline void RingBufferCopy_copy(void *dst, const void *src,
+                                       size_t len) {
+    uint8_t *tdst = (uint8_t *)dst;
+    const uint8_t *tsrc = (const uint8_t *)src;
+    if (len > 16) {
+        RingBufferCopy_long(tdst, tsrc, len);
+    } else if (len >= 8) {
+        uint64_t head, tail;
+        memcpy(&head, tsrc, 8);
+        memcpy(&tail, tsrc + len - 8, 8);
+        memcpy(tdst, &head, 8);
+        memcpy(tdst + len - 8, &tail, 8);
+    } else if (len >= 4) {
+        uint32_t head, tail;
+        memcpy(&head, tsrc, 4);
+        memcpy(&tail, tsrc + len - 4, 4);
+        memcpy(tdst, &head, 4);
+        memcpy(tdst + len - 4, &tail, 4);
+    } else if (len > 0) {
+        tdst[0] = tsrc[0];
+        tdst[len / 2] = tsrc[len / 2];
+        tdst[len - 1] = tsrc[len - 1];
+    }
+}
+
+// Copies len bytes from src to dst, which must not overlap, with non-temporal
+// stores where the CPU has them. RingBufferCopy_fence() must follow before the
+// bytes are published.
+static inline void RingBufferCopy_stream(void *dst, const void *src,
+                                         size_t len) {
+    uint8_t *tdst = (uint8_t *)dst;
+    const uint8_t *tsrc = (const uint8_t *)src;
+#ifdef RINGBUFFERCOPY_SSE2
+    size_t head = (size_t)(-(uintptr_t)tdst & 15);
+    if (len >= (head + 64)) {
+        RingBufferCopy_copy(tdst, tsrc, head);
+        tdst += head;
+        tsrc += head;
+        len -= head;
+        for (; len >= 64; tdst += 64, tsrc += 64, len -= 64) {
+            __m128i v0 = _mm_loadu_si128((const __m128i *)tsrc);
+            __m128i v1 = _mm_loadu_si128((const __m128i *)(tsrc + 16));
+            __m128i v2 = _mm_loadu_si128((const __m128i *)(tsrc + 32));
+            __m128i v3 = _mm_loadu_si128((const __m128i *)(tsrc + 48));
+            _mm_stream_si128((__m128i *)tdst, v0);
+            _mm_stream_si128((__m128i *)(tdst + 16), v1);
+            _mm_stream_si128((__m128i *)(tdst + 32), v2);
+            _mm_stream_si128((__m128i *)(tdst + 48), v3);
+        }
+    }
+#endif
+    RingBufferCopy_copy(tdst, tsrc, len);
+}
+
+// Orders the non-temporal stores of RingBufferCopy_stream() before the stores
+// that follow.
+static inline void RingBufferCopy_fence(void) {
+#ifdef RINGBUFFERCOPY_SSE2
+    _mm_sfence();
+#endif
+}
+
+// Prefetches the first RINGBUFFERCOPY_PREFETCH_MAX bytes at most of the len
+// bytes at src for reading.
+static inline void RingBufferCopy_prefetch(const void *src, size_t len) {
+    const char *tsrc = (const char *)src;
+    if (len > RINGBUFFERCOPY_PREFETCH_MAX) {
+        len = RINGBUFFERCOPY_PREFETCH_MAX;
+    }
+    for (size_t i = 0; i < len; i += 64) {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(tsrc + i);
+#elif defined(RINGBUFFERCOPY_SSE2)
+        _mm_prefetch(tsrc + i, _MM_HINT_T0);
+#else
+        (void)tsrc;
+#endif
+    }
+}
+
+#endif // _RINGBUFFERCOPY_H
@@ -0,0 +1,133 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Implements RingBufferIndex and associated functions.
+ */
+
+#ifndef _RINGBUFFERINDEX_C
+#define _RINGBUFFERINDEX_C
+
+#include "RingBufferIndex.h"
+
+#ifndef RINGBUFFER_HEADER_ONLY
+extern inline bool RingBufferIndex_initialize(RingBufferIndex *ri,
+                                              RingBuffer *rb, uint64_t *offs,
+                                              size_t cap);
+extern inline size_t
+RingBufferIndex_getRecordCapacity(const RingBufferIndex *ri);
+extern inline size_t RingBufferIndex_getRecordCount(const RingBufferIndex *ri);
+#endif
+
+// Returns the stream offset of record k, which must exist, or the end offset
+// for k equal to the record count.
+static uint64_t Index_offset(const RingBufferIndex *ri, size_t k) {
+    if (k == ri->_count) {
+        return ri->_end;
+    }
+    size_t i = ri->_head + k;
+    if (i >= ri->_cap) {
+        i -= ri->_cap;
+    }
+    return ri->_offs[i];
+}
+
+bool RingBufferIndex_appendRecord(RingBufferIndex *ri, const void *buf,
+                                  size_t len) {
+    if ((ri == NULL) || (buf == NULL) || (ri->_count == ri->_cap) ||
+        !RingBuffer_ensureWriteByteCapacity(ri->_rb, len)) {
+        return false;
+    }
+    if (len > 0) {
+        RingBuffer_writeBytes(ri->_rb, buf, len);
+    }
+    size_t i = ri->_head + ri->_count;
+    if (i >= ri->_cap) {
+        i -= ri->_cap;
+    }
+    ri->_offs[i] = ri->_end;
+    ri->_end += len;
+    ++ri->_count;
+    return true;
+}
+
+bool RingBufferIndex_seekRecord(const RingBufferIndex *ri, size_t k,
+                                size_t *pos, size_t *len) {
+    if ((ri == NULL) || (k >= ri->_count) || (pos == NULL)) {
+        return false;
+    }
+    uint64_t off = Index_offset(ri, k);
+    *pos = (size_t)(off - ri->_base);
+    if (len != NULL) {
+        *len = (size_t)(Index_offset(ri, k + 1) - off);
+    }
+    return true;
+}
+
+size_t RingBufferIndex_getRecordLength(const RingBufferIndex *ri, size_t k) {
+    size_t pos;
+    size_t len;
+    return RingBufferIndex_seekRecord(ri, k, &pos, &len) ? len : 0;
+}
+
+bool RingBufferIndex_peekRecord(const RingBufferIndex *ri, size_t k,
+                                RingBufferSegment seg[2]) {
+    size_t pos;
+    size_t len;
+    if ((seg == NULL) || !RingBufferIndex_seekRecord(ri, k, &pos, &len)) {
+        return false;
+    }
+    if (len == 0) {
+        seg[0].data = ri->_rb->_data;
+        seg[0].len = 0;
+        seg[1].data = ri->_rb->_data;
+        seg[1].len = 0;
+        return true;
+    }
+    return RingBuffer_peekSegmentsAt(ri->_rb, pos, seg, len) == len;
+}
+
+size_t RingBufferIndex_discardRecords(RingBufferIndex *ri, size_t k) {
+    if (ri == NULL) {
+        return 0;
+    }
+    if (k > ri->_count) {
+        k = ri->_count;
+    }
+    if (k == 0) {
+        return 0;
+    }
+    uint64_t off = Index_offset(ri, k);
+    RingBuffer_discardBytes(ri->_rb, (size_t)(off - ri->_base));
+    ri->_base = off;
+    ri->_head += k;
+    if (ri->_head >= ri->_cap) {
+        ri->_head -= ri->_cap;
+    }
+    ri->_count -= k;
+    return k;
+}
+
+#endif // _RINGBUFFERINDEX_C
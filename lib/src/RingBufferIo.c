@@ -0,0 +1,93 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Implements the functions that transfer bytes between RingBuffer and file
+ * descriptors.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "RingBufferIo.h"
+#include <errno.h>
+#include <limits.h>
+#include <sys/uio.h>
+
+ssize_t RingBuffer_readFromFd(RingBuffer *rb, int fd, size_t len) {
+    if ((rb == NULL) || (fd < 0) || (len == 0)) {
+        errno = EINVAL;
+        return -1;
+    }
+    if (len > SSIZE_MAX) {
+        len = SSIZE_MAX;
+    }
+    // Reserves the free bytes only, so that a growable ring buffer grows when
+    // it is full rather than to the maximum number of bytes to read.
+    size_t wcap = RingBuffer_getWriteByteCapacity(rb);
+    if ((wcap > 0) && (len > wcap)) {
+        len = wcap;
+    }
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    if (RingBuffer_reserveBytes(rb, seg, len) == 0) {
+        errno = ENOBUFS;
+        return -1;
+    }
+    struct iovec iov[2] = {{seg[0].data, seg[0].len},
+                           {seg[1].data, seg[1].len}};
+    ssize_t res;
+    do {
+        res = readv(fd, iov, (seg[1].len > 0) ? 2 : 1);
+    } while ((res < 0) && (errno == EINTR));
+    if (res <= 0) {
+        RingBuffer_abortBytes(rb);
+        return res;
+    }
+    RingBuffer_commitBytes(rb, (size_t)res);
+    return res;
+}
+
+ssize_t RingBuffer_writeToFd(RingBuffer *rb, int fd, size_t len) {
+    if ((rb == NULL) || (fd < 0) || (len == 0)) {
+        errno = EINVAL;
+        return -1;
+    }
+    if (len > SSIZE_MAX) {
+        len = SSIZE_MAX;
+    }
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    if (RingBuffer_peekSegments(rb, seg, len) == 0) {
+        return 0;
+    }
+    struct iovec iov[2] = {{seg[0].data, seg[0].len},
+                           {seg[1].data, seg[1].len}};
+    ssize_t res;
+    do {
+        res = writev(fd, iov, (seg[1].len > 0) ? 2 : 1);
+    } while ((res < 0) && (errno == EINTR));
+    if (res > 0) {
+        RingBuffer_consumeBytes(rb, (size_t)res);
+    }
+    return res;
+}
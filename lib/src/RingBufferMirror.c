@@ -0,0 +1,95 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Implements the functions that allocate mirrored data memory for RingBuffer.
+ */
+
+#define _GNU_SOURCE
+
+#include "RingBufferMirror.h"
+#include <errno.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+size_t RingBufferMirror_getPageSize(void) {
+    long size = sysconf(_SC_PAGESIZE);
+    return (size > 0) ? (size_t)size : 4096;
+}
+
+size_t RingBufferMirror_roundCapacity(size_t cap) {
+    size_t page = RingBufferMirror_getPageSize();
+    if ((cap == 0) || (cap > (SIZE_MAX / 2) - page)) {
+        return 0;
+    }
+    return (cap + page - 1) / page * page;
+}
+
+void *RingBufferMirror_allocate(size_t cap) {
+    if ((cap == 0) || (cap > SIZE_MAX / 2) ||
+        (cap % RingBufferMirror_getPageSize() != 0)) {
+        errno = EINVAL;
+        return NULL;
+    }
+    int fd = memfd_create("RingBuffer", MFD_CLOEXEC);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (ftruncate(fd, (off_t)cap) != 0) {
+        int error = errno;
+        close(fd);
+        errno = error;
+        return NULL;
+    }
+    // Reserves the address space for both mappings before placing them.
+    uint8_t *data = (uint8_t *)mmap(NULL, 2 * cap, PROT_NONE,
+                                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+        int error = errno;
+        close(fd);
+        errno = error;
+        return NULL;
+    }
+    if ((mmap(data, cap, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd,
+              0) == MAP_FAILED) ||
+        (mmap(data + cap, cap, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+              fd, 0) == MAP_FAILED)) {
+        int error = errno;
+        munmap(data, 2 * cap);
+        close(fd);
+        errno = error;
+        return NULL;
+    }
+    close(fd);
+    return data;
+}
+
+bool RingBufferMirror_free(void *data, size_t cap) {
+    if ((data == NULL) || (cap == 0) || (cap > SIZE_MAX / 2)) {
+        return false;
+    }
+    return munmap(data, 2 * cap) == 0;
+}
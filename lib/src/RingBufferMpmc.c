@@ -0,0 +1,175 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Implements RingBufferMpmc and associated functions.
+ */
+
+#include "RingBufferMpmc.h"
+#include <string.h>
+
+extern inline void *RingBufferMpmc_getDataPointer(const RingBufferMpmc *rb);
+extern inline size_t RingBufferMpmc_getElementSize(const RingBufferMpmc *rb);
+extern inline size_t
+RingBufferMpmc_getElementCapacity(const RingBufferMpmc *rb);
+
+// Returns the size in bytes of a slot holding a sequence number and an element.
+static size_t slotSize(size_t elemSize) {
+    const size_t align = _Alignof(atomic_size_t);
+    if (elemSize > (SIZE_MAX - sizeof(atomic_size_t) - align)) {
+        return 0;
+    }
+    return (sizeof(atomic_size_t) + elemSize + align - 1) & ~(align - 1);
+}
+
+// Returns the sequence number of the slot for the index.
+static atomic_size_t *sequence(const RingBufferMpmc *rb, size_t pos) {
+    return (atomic_size_t *)(void *)(rb->_data +
+                                     (pos & rb->_mask) * rb->_slotSize);
+}
+
+// Returns the element of the slot for the index.
+static uint8_t *element(const RingBufferMpmc *rb, size_t pos) {
+    return rb->_data + (pos & rb->_mask) * rb->_slotSize +
+           sizeof(atomic_size_t);
+}
+
+// Returns the signed distance from the index to the sequence number.
+static ptrdiff_t distance(size_t seq, size_t pos) {
+    return (ptrdiff_t)(seq - pos);
+}
+
+// Claims up to count consecutive slots from the index, whose sequence numbers
+// are the indices plus the lag when they are ready, and returns the number of
+// slots claimed, with the first index in pos.
+static size_t claim(RingBufferMpmc *rb, atomic_size_t *index, size_t *pos,
+                    size_t lag, size_t count) {
+    if (count > (rb->_mask + 1)) {
+        count = rb->_mask + 1;
+    }
+    *pos = atomic_load_explicit(index, memory_order_relaxed);
+    for (;;) {
+        size_t seq = atomic_load_explicit(sequence(rb, *pos),
+                                          memory_order_acquire);
+        ptrdiff_t dist = distance(seq, *pos + lag);
+        if (dist < 0) {
+            return 0;
+        }
+        if (dist > 0) {
+            // Another thread claimed the slot since the index was loaded.
+            *pos = atomic_load_explicit(index, memory_order_relaxed);
+            continue;
+        }
+        size_t n = 1;
+        while ((n < count) &&
+               (atomic_load_explicit(sequence(rb, *pos + n),
+                                     memory_order_acquire) ==
+                (*pos + n + lag))) {
+            ++n;
+        }
+        // Slots ready before the index moves stay ready until it moves past
+        // them, so succeeding here means that all n slots are claimed.
+        if (atomic_compare_exchange_weak_explicit(index, pos, *pos + n,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+            return n;
+        }
+    }
+}
+
+size_t RingBufferMpmc_getMemorySize(size_t elemSize, size_t count) {
+    size_t size = slotSize(elemSize);
+    if ((size == 0) || (elemSize == 0) || (count == 0) ||
+        (count > (SIZE_MAX / size))) {
+        return 0;
+    }
+    return count * size;
+}
+
+bool RingBufferMpmc_initialize(RingBufferMpmc *rb, void *data, size_t cap,
+                               size_t elemSize) {
+    size_t size = slotSize(elemSize);
+    if ((rb == NULL) || (data == NULL) ||
+        (((uintptr_t)data % _Alignof(atomic_size_t)) != 0) ||
+        (elemSize == 0) || (size == 0) || ((cap / size) < 2)) {
+        return false;
+    }
+    size_t count = 2;
+    while (count <= ((cap / size) / 2)) {
+        count *= 2;
+    }
+    rb->_data = (uint8_t *)data;
+    rb->_elemSize = elemSize;
+    rb->_slotSize = size;
+    rb->_mask = count - 1;
+    for (size_t i = 0; i < count; ++i) {
+        atomic_init(sequence(rb, i), i);
+    }
+    atomic_init(&rb->_epos, 0);
+    atomic_init(&rb->_dpos, 0);
+    return true;
+}
+
+bool RingBufferMpmc_enqueue(RingBufferMpmc *rb, const void *elem) {
+    return RingBufferMpmc_enqueueBatch(rb, elem, 1) == 1;
+}
+
+size_t RingBufferMpmc_enqueueBatch(RingBufferMpmc *rb, const void *elems,
+                                   size_t count) {
+    if ((rb == NULL) || (elems == NULL) || (count == 0)) {
+        return 0;
+    }
+    const uint8_t *telems = (const uint8_t *)elems;
+    size_t pos;
+    size_t n = claim(rb, &rb->_epos, &pos, 0, count);
+    for (size_t i = 0; i < n; ++i) {
+        memcpy(element(rb, pos + i), telems + i * rb->_elemSize,
+               rb->_elemSize);
+        atomic_store_explicit(sequence(rb, pos + i), pos + i + 1,
+                              memory_order_release);
+    }
+    return n;
+}
+
+bool RingBufferMpmc_dequeue(RingBufferMpmc *rb, void *elem) {
+    return RingBufferMpmc_dequeueBatch(rb, elem, 1) == 1;
+}
+
+size_t RingBufferMpmc_dequeueBatch(RingBufferMpmc *rb, void *elems,
+                                   size_t count) {
+    if ((rb == NULL) || (elems == NULL) || (count == 0)) {
+        return 0;
+    }
+    uint8_t *telems = (uint8_t *)elems;
+    size_t pos;
+    size_t n = claim(rb, &rb->_dpos, &pos, 1, count);
+    for (size_t i = 0; i < n; ++i) {
+        memcpy(telems + i * rb->_elemSize, element(rb, pos + i),
+               rb->_elemSize);
+        atomic_store_explicit(sequence(rb, pos + i), pos + i + rb->_mask + 1,
+                              memory_order_release);
+    }
+    return n;
+}
@@ -0,0 +1,206 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Implements RingBufferMpsc and associated functions.
+ */
+
+#include "RingBufferMpsc.h"
+#include "RingBufferWrap.h"
+#include <string.h>
+
+extern inline void *RingBufferMpsc_getDataPointer(const RingBufferMpsc *rb);
+extern inline size_t RingBufferMpsc_getByteCapacity(const RingBufferMpsc *rb);
+extern inline bool RingBufferMpsc_isEmpty(RingBufferMpsc *rb);
+
+// A record header is zero until the record is committed, and then holds the
+// number of bytes in the record shifted left by two together with the flags.
+#define RECORD_COMMITTED 0x1u
+#define RECORD_ABORTED 0x2u
+#define RECORD_MAX_LEN (UINT32_MAX >> 2)
+
+// Returns the header of the record at the data memory offset.
+static _Atomic uint32_t *header(const RingBufferMpsc *rb, size_t off) {
+    return (_Atomic uint32_t *)(void *)(rb->_data + off);
+}
+
+// Fills the segments with the len bytes following the record header at the
+// data memory offset.
+static void segments(const RingBufferMpsc *rb, size_t off, size_t len,
+                     RingBufferSegment seg[2]) {
+    off += RINGBUFFERMPSC_HEADER_SIZE;
+    if (off >= rb->_cap) {
+        off -= rb->_cap;
+    }
+    RingBufferWrap_segments(rb->_data, rb->_cap, off, len, seg);
+}
+
+// Zeroes the data memory of the record at the read index and releases it to
+// the producers.
+static void release(RingBufferMpsc *rb, size_t rpos, size_t len) {
+    size_t size = RINGBUFFERMPSC_RECORD_SIZE(len);
+    size_t off = RingBufferWrap_offset(rb->_cap, rpos);
+    if ((off + size) > rb->_cap) {
+        memset(rb->_data + off, 0, rb->_cap - off);
+        memset(rb->_data, 0, size - (rb->_cap - off));
+    } else {
+        memset(rb->_data + off, 0, size);
+    }
+    atomic_store_explicit(&rb->_rpos,
+                          RingBufferWrap_advance(rb->_cap, rpos, size),
+                          memory_order_release);
+}
+
+// Returns the header of the oldest committed record after releasing any
+// aborted records before it, or zero if the oldest record is not committed.
+static uint32_t oldest(RingBufferMpsc *rb, size_t *rpos) {
+    for (;;) {
+        *rpos = atomic_load_explicit(&rb->_rpos, memory_order_relaxed);
+        size_t off = RingBufferWrap_offset(rb->_cap, *rpos);
+        uint32_t hdr =
+            atomic_load_explicit(header(rb, off), memory_order_acquire);
+        if ((hdr & RECORD_ABORTED) == 0) {
+            return hdr;
+        }
+        release(rb, *rpos, hdr >> 2);
+    }
+}
+
+bool RingBufferMpsc_initialize(RingBufferMpsc *rb, void *data, size_t cap) {
+    if ((rb == NULL) || (data == NULL) ||
+        (((uintptr_t)data % RINGBUFFERMPSC_HEADER_SIZE) != 0) || (cap == 0) ||
+        ((cap % RINGBUFFERMPSC_HEADER_SIZE) != 0) || (cap > SIZE_MAX / 2)) {
+        return false;
+    }
+    memset(data, 0, cap);
+    rb->_data = (uint8_t *)data;
+    rb->_cap = cap;
+    atomic_init(&rb->_wpos, 0);
+    atomic_init(&rb->_rpos, 0);
+    return true;
+}
+
+bool RingBufferMpsc_claimBytes(RingBufferMpsc *rb, RingBufferMpscClaim *claim,
+                               size_t len) {
+    if ((rb == NULL) || (claim == NULL) || (len > RECORD_MAX_LEN) ||
+        (len > (rb->_cap - RINGBUFFERMPSC_HEADER_SIZE))) {
+        return false;
+    }
+    size_t size = RINGBUFFERMPSC_RECORD_SIZE(len);
+    size_t wpos = atomic_load_explicit(&rb->_wpos, memory_order_relaxed);
+    do {
+        // Acquires the consumer's zeroing of the released data memory.
+        size_t rpos = atomic_load_explicit(&rb->_rpos, memory_order_acquire);
+        if ((rb->_cap - RingBufferWrap_used(rb->_cap, wpos, rpos)) < size) {
+            return false;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(
+        &rb->_wpos, &wpos, RingBufferWrap_advance(rb->_cap, wpos, size),
+        memory_order_relaxed, memory_order_relaxed));
+    claim->_off = RingBufferWrap_offset(rb->_cap, wpos);
+    claim->_len = len;
+    segments(rb, claim->_off, len, claim->seg);
+    return true;
+}
+
+bool RingBufferMpsc_commitBytes(RingBufferMpsc *rb,
+                                const RingBufferMpscClaim *claim) {
+    if ((rb == NULL) || (claim == NULL)) {
+        return false;
+    }
+    atomic_store_explicit(header(rb, claim->_off),
+                          ((uint32_t)claim->_len << 2) | RECORD_COMMITTED,
+                          memory_order_release);
+    return true;
+}
+
+bool RingBufferMpsc_abortBytes(RingBufferMpsc *rb,
+                               const RingBufferMpscClaim *claim) {
+    if ((rb == NULL) || (claim == NULL)) {
+        return false;
+    }
+    atomic_store_explicit(header(rb, claim->_off),
+                          ((uint32_t)claim->_len << 2) | RECORD_COMMITTED |
+                              RECORD_ABORTED,
+                          memory_order_release);
+    return true;
+}
+
+bool RingBufferMpsc_writeBytes(RingBufferMpsc *rb, const void *buf,
+                               size_t len) {
+    RingBufferMpscClaim claim;
+    if ((buf == NULL) || !RingBufferMpsc_claimBytes(rb, &claim, len)) {
+        return false;
+    }
+    memcpy(claim.seg[0].data, buf, claim.seg[0].len);
+    memcpy(claim.seg[1].data, (const uint8_t *)buf + claim.seg[0].len,
+           claim.seg[1].len);
+    return RingBufferMpsc_commitBytes(rb, &claim);
+}
+
+bool RingBufferMpsc_peekRecord(RingBufferMpsc *rb, RingBufferSegment seg[2]) {
+    if ((rb == NULL) || (seg == NULL)) {
+        return false;
+    }
+    size_t rpos;
+    uint32_t hdr = oldest(rb, &rpos);
+    if (hdr == 0) {
+        return false;
+    }
+    segments(rb, RingBufferWrap_offset(rb->_cap, rpos), hdr >> 2, seg);
+    return true;
+}
+
+bool RingBufferMpsc_discardRecord(RingBufferMpsc *rb) {
+    if (rb == NULL) {
+        return false;
+    }
+    size_t rpos;
+    uint32_t hdr = oldest(rb, &rpos);
+    if (hdr == 0) {
+        return false;
+    }
+    release(rb, rpos, hdr >> 2);
+    return true;
+}
+
+bool RingBufferMpsc_readRecord(RingBufferMpsc *rb, void *buf, size_t cap,
+                               size_t *len) {
+    if ((rb == NULL) || (buf == NULL) || (len == NULL)) {
+        return false;
+    }
+    size_t rpos;
+    uint32_t hdr = oldest(rb, &rpos);
+    *len = hdr >> 2;
+    if ((hdr == 0) || (*len > cap)) {
+        return false;
+    }
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    segments(rb, RingBufferWrap_offset(rb->_cap, rpos), *len, seg);
+    memcpy(buf, seg[0].data, seg[0].len);
+    memcpy((uint8_t *)buf + seg[0].len, seg[1].data, seg[1].len);
+    release(rb, rpos, *len);
+    return true;
+}
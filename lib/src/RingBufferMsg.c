@@ -0,0 +1,140 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Implements RingBufferMsg and associated functions.
+ */
+
+#ifndef _RINGBUFFERMSG_C
+#define _RINGBUFFERMSG_C
+
+#include "RingBufferMsg.h"
+#include <string.h>
+
+#ifndef RINGBUFFER_HEADER_ONLY
+extern inline bool RingBufferMsg_initialize(RingBufferMsg *rb, void *data,
+                                            size_t cap);
+extern inline bool RingBufferMsg_reset(RingBufferMsg *rb);
+extern inline size_t RingBufferMsg_getByteCapacity(const RingBufferMsg *rb);
+extern inline bool RingBufferMsg_isEmpty(const RingBufferMsg *rb);
+extern inline size_t RingBufferMsg_getMessageSize(size_t len);
+#endif
+
+// Decodes the oldest message's header, returning its size in bytes and the
+// message length, or zero if the ring buffer is empty or the header is
+// malformed.
+static size_t Msg_header(const RingBufferMsg *rb, size_t *len) {
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    size_t avail = RingBuffer_peekSegments(&rb->_rb, seg,
+                                           RINGBUFFERMSG_MAX_HEADER_SIZE);
+    size_t value = 0;
+    for (size_t i = 0; i < avail; ++i) {
+        uint8_t byte = (i < seg[0].len) ? seg[0].data[i]
+                                        : seg[1].data[i - seg[0].len];
+        value |= (size_t)(byte & 0x7fu) << (7 * i);
+        if ((byte & 0x80u) == 0) {
+            *len = value;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+bool RingBufferMsg_fits(const RingBufferMsg *rb, size_t len) {
+    if (rb == NULL) {
+        return false;
+    }
+    size_t wcap = RingBuffer_getWriteByteCapacity(&rb->_rb);
+    return (len < wcap) && (RingBufferMsg_getMessageSize(len) <= wcap);
+}
+
+bool RingBufferMsg_pushMessage(RingBufferMsg *rb, const void *buf,
+                               size_t len) {
+    if ((rb == NULL) || (buf == NULL) || !RingBufferMsg_fits(rb, len)) {
+        return false;
+    }
+    uint8_t hdr[RINGBUFFERMSG_MAX_HEADER_SIZE];
+    size_t size = 0;
+    size_t rest = len;
+    while (rest >= 0x80u) {
+        hdr[size++] = (uint8_t)(rest | 0x80u);
+        rest >>= 7;
+    }
+    hdr[size++] = (uint8_t)rest;
+    RingBuffer_writeBytes(&rb->_rb, hdr, size);
+    RingBuffer_writeBytes(&rb->_rb, buf, len);
+    return true;
+}
+
+bool RingBufferMsg_peekMessage(const RingBufferMsg *rb,
+                               RingBufferSegment seg[2]) {
+    size_t len;
+    size_t size;
+    if ((rb == NULL) || (seg == NULL) || ((size = Msg_header(rb, &len)) == 0)) {
+        return false;
+    }
+    if (len == 0) {
+        seg[0].data = rb->_rb._data;
+        seg[0].len = 0;
+        seg[1].data = rb->_rb._data;
+        seg[1].len = 0;
+        return true;
+    }
+    return RingBuffer_peekSegmentsAt(&rb->_rb, size, seg, len) == len;
+}
+
+bool RingBufferMsg_popMessage(RingBufferMsg *rb) {
+    size_t len;
+    size_t size;
+    if ((rb == NULL) || ((size = Msg_header(rb, &len)) == 0)) {
+        return false;
+    }
+    RingBuffer_discardBytes(&rb->_rb, size + len);
+    return true;
+}
+
+bool RingBufferMsg_readMessage(RingBufferMsg *rb, void *buf, size_t cap,
+                               size_t *len) {
+    if ((rb == NULL) || (buf == NULL) || (len == NULL)) {
+        return false;
+    }
+    *len = 0;
+    size_t size = Msg_header(rb, len);
+    if ((size == 0) || (*len > cap)) {
+        return false;
+    }
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    if (*len > 0) {
+        if (RingBuffer_peekSegmentsAt(&rb->_rb, size, seg, *len) != *len) {
+            return false;
+        }
+        memcpy(buf, seg[0].data, seg[0].len);
+        memcpy((uint8_t *)buf + seg[0].len, seg[1].data, seg[1].len);
+    }
+    RingBuffer_discardBytes(&rb->_rb, size + *len);
+    return true;
+}
+
+#endif // _RINGBUFFERMSG_C
@@ -0,0 +1,71 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Implements the functions that release the physical memory of idle RingBuffer
+ * and RingBufferWo data memory.
+ */
+
+#define _DEFAULT_SOURCE
+
+#include "RingBufferReclaim.h"
+#include <sys/mman.h>
+#include <unistd.h>
+
+size_t RingBufferReclaim_releasePages(void *data, size_t len, bool mirrored) {
+    long size = sysconf(_SC_PAGESIZE);
+    if ((data == NULL) || (len == 0) || (size <= 0)) {
+        return 0;
+    }
+    uintptr_t page = (uintptr_t)size;
+    uintptr_t start = ((uintptr_t)data + page - 1) / page * page;
+    uintptr_t end = ((uintptr_t)data + len) / page * page;
+    if (end <= start) {
+        return 0;
+    }
+#if defined(__linux__)
+    int advice = mirrored ? MADV_REMOVE : MADV_DONTNEED;
+#elif defined(MADV_FREE)
+    int advice = MADV_FREE;
+    (void)mirrored;
+#else
+    int advice = MADV_DONTNEED;
+    (void)mirrored;
+#endif
+    if (madvise((void *)start, end - start, advice) != 0) {
+        return 0;
+    }
+    return end - start;
+}
+
+size_t RingBufferWo_resetAndReclaim(RingBufferWo *rb) {
+    if (rb == NULL) {
+        return 0;
+    }
+    RingBufferWo_reset(rb);
+    return RingBufferReclaim_releasePages(RingBufferWo_getDataPointer(rb),
+                                          RingBufferWo_getByteCapacity(rb),
+                                          false);
+}
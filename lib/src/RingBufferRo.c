@@ -27,66 +27,106 @@ SOFTWARE.
  * Implements RingBufferRo and associated functions.
  */
 
+#ifndef _RINGBUFFERRO_C
+#define _RINGBUFFERRO_C
+
 #include "RingBufferRo.h"
-#include <string.h>
+#include "RingBufferCopy.h"
 
-size_t RingBufferRo_readBytes(RingBufferRo *rb, void *buf, size_t len) {
-    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
-        return 0;
+#ifndef RINGBUFFER_HEADER_ONLY
+extern inline bool RingBufferRo_initialize(RingBufferRo *rb, void *data,
+                                           size_t cap);
+extern inline bool RingBufferRo_reset(RingBufferRo *rb);
+extern inline void *RingBufferRo_getDataPointer(const RingBufferRo *rb);
+extern inline size_t RingBufferRo_getByteCapacity(const RingBufferRo *rb);
+extern inline size_t RingBufferRo_getReadBytePosition(const RingBufferRo *rb);
+#endif
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef unsigned __int128 Ro_uint128;
+#endif
+
+// Returns the high 64 bits of the 128-bit product of a and b.
+static uint64_t Ro_mulhi(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+    return (uint64_t)(((Ro_uint128)a * b) >> 64);
+#else
+    uint64_t alo = a & UINT32_MAX;
+    uint64_t ahi = a >> 32;
+    uint64_t blo = b & UINT32_MAX;
+    uint64_t bhi = b >> 32;
+    uint64_t mid = (alo * blo >> 32) + (ahi * blo & UINT32_MAX) + alo * bhi;
+    return ahi * bhi + (ahi * blo >> 32) + (mid >> 32);
+#endif
+}
+
+// Returns pos modulo the capacity. A position that wrapped at most once only
+// needs a subtraction, and only a position above UINT32_MAX or a capacity
+// above UINT32_MAX that is not a power of two needs a division.
+static size_t Ro_wrap(const RingBufferRo *rb, size_t pos) {
+    if (rb->_mask != 0) {
+        return pos & rb->_mask;
     }
-    uint8_t *tbuf = (uint8_t *)buf;
-    size_t left = len;
-    while ((rb->_rpos + left) >= rb->_cap) {
-        size_t copy = rb->_cap - rb->_rpos;
-        memcpy(tbuf, rb->_data + rb->_rpos, copy);
-        rb->_rpos = 0;
-        tbuf += copy;
-        left -= copy;
+    if (pos < rb->_cap) {
+        return pos;
     }
-    if (left > 0) {
-        memcpy(tbuf, rb->_data + rb->_rpos, left);
-        rb->_rpos += left;
+    if ((pos - rb->_cap) < rb->_cap) {
+        return pos - rb->_cap;
     }
-    return len;
+    if ((rb->_recip != 0) && (pos <= UINT32_MAX)) {
+        // Lemire's fastmod: the fraction pos / cap in 64-bit fixed point,
+        // scaled back by the capacity.
+        return (size_t)Ro_mulhi(rb->_recip * pos, rb->_cap);
+    }
+    return pos % rb->_cap;
 }
 
-size_t RingBufferRo_peekBytes(const RingBufferRo *rb, void *buf, size_t len) {
-    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+// Copies len bytes starting at rpos to tbuf, wrapping as often as needed.
+static void Ro_copyOut(const RingBufferRo *rb, size_t rpos, uint8_t *tbuf,
+                       size_t len) {
+    size_t first = rb->_cap - rpos;
+    while (len > first) {
+        RingBufferCopy_copy(tbuf, rb->_data + rpos, first);
+        rpos = 0;
+        tbuf += first;
+        len -= first;
+        first = rb->_cap;
+    }
+    RingBufferCopy_copy(tbuf, rb->_data + rpos, len);
+}
+
+size_t RingBufferRo_discardBytes(RingBufferRo *rb, size_t len) {
+    if (RINGBUFFER_ISNULL(rb) || (len == 0)) {
         return 0;
     }
-    uint8_t *tbuf = (uint8_t *)buf;
-    size_t left = len;
-    size_t rpos = rb->_rpos;
-    while ((rpos + left) >= rb->_cap) {
-        size_t copy = rb->_cap - rpos;
-        memcpy(tbuf, rb->_data + rpos, copy);
-        rpos = 0;
-        tbuf += copy;
-        left -= copy;
+    rb->_rpos = Ro_wrap(rb, rb->_rpos + len);
+    return len;
+}
+
+size_t RingBufferRo_readBytes(RingBufferRo *rb, void *buf, size_t len) {
+    if (RINGBUFFER_ISNULL(rb) || RINGBUFFER_ISNULL(buf) || (len == 0)) {
+        return 0;
     }
-    if (left > 0) {
-        memcpy(tbuf, rb->_data + rpos, left);
+    Ro_copyOut(rb, rb->_rpos, (uint8_t *)buf, len);
+    rb->_rpos = Ro_wrap(rb, rb->_rpos + len);
+    return len;
+}
+
+size_t RingBufferRo_peekBytes(const RingBufferRo *rb, void *buf, size_t len) {
+    if (RINGBUFFER_ISNULL(rb) || RINGBUFFER_ISNULL(buf) || (len == 0)) {
+        return 0;
     }
+    Ro_copyOut(rb, rb->_rpos, (uint8_t *)buf, len);
     return len;
 }
 
 size_t RingBufferRo_peekBytesAt(const RingBufferRo *rb, size_t pos, void *buf,
                                 size_t len) {
-    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+    if (RINGBUFFER_ISNULL(rb) || RINGBUFFER_ISNULL(buf) || (len == 0)) {
         return 0;
     }
-    uint8_t *tbuf = (uint8_t *)buf;
-    size_t left = len;
-    size_t rpos = (rb->_rpos + pos) % rb->_cap;
-    while ((rpos + left) >= rb->_cap) {
-        size_t copy = rb->_cap - rpos;
-        memcpy(tbuf, rb->_data + rpos, copy);
-        rpos = 0;
-        tbuf += copy;
-        left -= copy;
-    }
-    if (left > 0) {
-        memcpy(tbuf, rb->_data + rpos, left);
-    }
+    Ro_copyOut(rb, Ro_wrap(rb, rb->_rpos + pos), (uint8_t *)buf, len);
     return len;
 }
+
+#endif // _RINGBUFFERRO_C
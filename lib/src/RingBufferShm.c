@@ -0,0 +1,229 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Implements RingBufferShm and associated functions.
+ */
+
+#include "RingBufferShm.h"
+#include "RingBufferWrap.h"
+
+extern inline void *RingBufferShm_getDataPointer(const RingBufferShm *rb);
+extern inline size_t RingBufferShm_getByteCapacity(const RingBufferShm *rb);
+extern inline bool RingBufferShm_isEmpty(RingBufferShm *rb);
+extern inline bool RingBufferShm_isFull(RingBufferShm *rb);
+
+// Returns the producer's write capacity, only loading the consumer's read index
+// if the cached copy does not leave room for len bytes.
+static size_t writeCapacity(RingBufferShm *rb, uint64_t wpos, size_t len) {
+    return (size_t)RINGBUFFERWRAP_WRITE_CAPACITY(rb->_cap, wpos,
+                                                 rb->_region->_rpos,
+                                                 rb->_rposCache, len);
+}
+
+// Returns the consumer's read capacity, only loading the producer's write index
+// if the cached copy does not hold len bytes.
+static size_t readCapacity(RingBufferShm *rb, uint64_t rpos, size_t len) {
+    return (size_t)RINGBUFFERWRAP_READ_CAPACITY(rb->_cap, rpos,
+                                                rb->_region->_wpos,
+                                                rb->_wposCache, len);
+}
+
+// Sets up the process-local handle on the validated region.
+static void setHandle(RingBufferShm *rb, RingBufferShmRegion *region,
+                      uint64_t cap, uint64_t wpos, uint64_t rpos) {
+    rb->_region = region;
+    rb->_data = (uint8_t *)region + sizeof(RingBufferShmRegion);
+    rb->_cap = (size_t)cap;
+    rb->_rposCache = rpos;
+    rb->_wposCache = wpos;
+}
+
+size_t RingBufferShm_getRegionSize(size_t cap) {
+    if ((cap == 0) || (cap > (SIZE_MAX - sizeof(RingBufferShmRegion))) ||
+        ((uint64_t)cap > (UINT64_MAX / 2))) {
+        return 0;
+    }
+    return sizeof(RingBufferShmRegion) + cap;
+}
+
+bool RingBufferShm_initialize(RingBufferShm *rb, void *mem, size_t size) {
+    if ((rb == NULL) || (mem == NULL) ||
+        (((uintptr_t)mem % _Alignof(RingBufferShmRegion)) != 0) ||
+        (size <= sizeof(RingBufferShmRegion)) ||
+        ((uint64_t)(size - sizeof(RingBufferShmRegion)) > (UINT64_MAX / 2))) {
+        return false;
+    }
+    RingBufferShmRegion *region = (RingBufferShmRegion *)mem;
+    // Processes can only share address-free atomics, which in practice means
+    // lock-free ones.
+    if (!atomic_is_lock_free(&region->_wpos) ||
+        !atomic_is_lock_free(&region->_magic)) {
+        return false;
+    }
+    // Invalidates the region first in case it held an older ring buffer.
+    atomic_store_explicit(&region->_magic, 0, memory_order_relaxed);
+    region->_version = RINGBUFFERSHM_VERSION;
+    region->_cap = size - sizeof(RingBufferShmRegion);
+    region->_offset = sizeof(RingBufferShmRegion);
+    atomic_store_explicit(&region->_wpos, 0, memory_order_relaxed);
+    atomic_store_explicit(&region->_rpos, 0, memory_order_relaxed);
+    atomic_store_explicit(&region->_magic, RINGBUFFERSHM_MAGIC,
+                          memory_order_release);
+    setHandle(rb, region, region->_cap, 0, 0);
+    return true;
+}
+
+bool RingBufferShm_attach(RingBufferShm *rb, void *mem, size_t size) {
+    if ((rb == NULL) || (mem == NULL) ||
+        (((uintptr_t)mem % _Alignof(RingBufferShmRegion)) != 0) ||
+        (size <= sizeof(RingBufferShmRegion))) {
+        return false;
+    }
+    RingBufferShmRegion *region = (RingBufferShmRegion *)mem;
+    if (!atomic_is_lock_free(&region->_wpos) ||
+        !atomic_is_lock_free(&region->_magic) ||
+        (atomic_load_explicit(&region->_magic, memory_order_acquire) !=
+         RINGBUFFERSHM_MAGIC)) {
+        return false;
+    }
+    // Reads the layout once, so that the checks and the handle agree even if
+    // another process changes it meanwhile.
+    uint32_t version = region->_version;
+    uint64_t cap = region->_cap;
+    uint64_t offset = region->_offset;
+    if ((version != RINGBUFFERSHM_VERSION) ||
+        (offset != sizeof(RingBufferShmRegion)) || (cap == 0) ||
+        (cap > (uint64_t)(size - sizeof(RingBufferShmRegion)))) {
+        return false;
+    }
+    uint64_t wpos = atomic_load_explicit(&region->_wpos, memory_order_acquire);
+    uint64_t rpos = atomic_load_explicit(&region->_rpos, memory_order_acquire);
+    if ((wpos >= 2 * cap) || (rpos >= 2 * cap) ||
+        (RingBufferWrap_used(cap, wpos, rpos) > cap)) {
+        return false;
+    }
+    setHandle(rb, region, cap, wpos, rpos);
+    return true;
+}
+
+size_t RingBufferShm_getWriteByteCapacity(RingBufferShm *rb) {
+    if (rb == NULL) {
+        return 0;
+    }
+    uint64_t wpos =
+        atomic_load_explicit(&rb->_region->_wpos, memory_order_relaxed);
+    return writeCapacity(rb, wpos, rb->_cap);
+}
+
+size_t RingBufferShm_getReadByteCapacity(RingBufferShm *rb) {
+    if (rb == NULL) {
+        return 0;
+    }
+    uint64_t rpos =
+        atomic_load_explicit(&rb->_region->_rpos, memory_order_relaxed);
+    return readCapacity(rb, rpos, rb->_cap);
+}
+
+size_t RingBufferShm_writeBytes(RingBufferShm *rb, const void *buf,
+                                size_t len) {
+    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    uint64_t wpos =
+        atomic_load_explicit(&rb->_region->_wpos, memory_order_relaxed);
+    size_t wcap = writeCapacity(rb, wpos, len);
+    if (len > wcap) {
+        len = wcap;
+    }
+    RingBufferWrap_copyIn(rb->_data, rb->_cap, wpos, (const uint8_t *)buf, len);
+    atomic_store_explicit(&rb->_region->_wpos,
+                          RingBufferWrap_advance(rb->_cap, wpos, len),
+                          memory_order_release);
+    return len;
+}
+
+size_t RingBufferShm_discardBytes(RingBufferShm *rb, size_t len) {
+    if ((rb == NULL) || (len == 0)) {
+        return 0;
+    }
+    uint64_t rpos =
+        atomic_load_explicit(&rb->_region->_rpos, memory_order_relaxed);
+    size_t rcap = readCapacity(rb, rpos, len);
+    if (len > rcap) {
+        len = rcap;
+    }
+    atomic_store_explicit(&rb->_region->_rpos,
+                          RingBufferWrap_advance(rb->_cap, rpos, len),
+                          memory_order_release);
+    return len;
+}
+
+size_t RingBufferShm_readBytes(RingBufferShm *rb, void *buf, size_t len) {
+    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    uint64_t rpos =
+        atomic_load_explicit(&rb->_region->_rpos, memory_order_relaxed);
+    size_t rcap = readCapacity(rb, rpos, len);
+    if (len > rcap) {
+        len = rcap;
+    }
+    RingBufferWrap_copyOut(rb->_data, rb->_cap, rpos, (uint8_t *)buf, len);
+    atomic_store_explicit(&rb->_region->_rpos,
+                          RingBufferWrap_advance(rb->_cap, rpos, len),
+                          memory_order_release);
+    return len;
+}
+
+size_t RingBufferShm_peekBytes(RingBufferShm *rb, void *buf, size_t len) {
+    return RingBufferShm_peekBytesAt(rb, 0, buf, len);
+}
+
+size_t RingBufferShm_peekBytesAt(RingBufferShm *rb, size_t pos, void *buf,
+                                 size_t len) {
+    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    size_t cap = rb->_cap;
+    uint64_t rpos =
+        atomic_load_explicit(&rb->_region->_rpos, memory_order_relaxed);
+    size_t need = cap;
+    if ((pos < cap) && (len < (cap - pos))) {
+        need = pos + len;
+    }
+    size_t rcap = readCapacity(rb, rpos, need);
+    if (pos >= rcap) {
+        return 0;
+    }
+    rcap -= pos;
+    if (len > rcap) {
+        len = rcap;
+    }
+    RingBufferWrap_copyOut(rb->_data, rb->_cap,
+                           RingBufferWrap_advance(rb->_cap, rpos, pos),
+                           (uint8_t *)buf, len);
+    return len;
+}
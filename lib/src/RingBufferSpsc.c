@@ -0,0 +1,520 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Implements RingBufferSpsc and associated functions.
+ */
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
+#include "RingBufferSpsc.h"
+#include "RingBufferWrap.h"
+#include <time.h>
+#ifdef __linux__
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif !defined(__STDC_NO_THREADS__)
+#include <threads.h>
+#endif
+
+extern inline bool RingBufferSpsc_initialize(RingBufferSpsc *rb, void *data,
+                                             size_t cap);
+extern inline bool RingBufferSpsc_reset(RingBufferSpsc *rb);
+extern inline void *RingBufferSpsc_getDataPointer(const RingBufferSpsc *rb);
+extern inline size_t RingBufferSpsc_getByteCapacity(const RingBufferSpsc *rb);
+extern inline bool RingBufferSpsc_isEmpty(RingBufferSpsc *rb);
+extern inline bool RingBufferSpsc_isFull(RingBufferSpsc *rb);
+#ifdef __linux__
+extern inline int RingBufferSpsc_getReadEventFd(const RingBufferSpsc *rb);
+extern inline int RingBufferSpsc_getWriteEventFd(const RingBufferSpsc *rb);
+#endif
+
+#define NANOSECONDS_PER_SECOND 1000000000u
+
+// Returns the producer's write capacity, only loading the consumer's read index
+// if the cached copy does not leave room for len bytes.
+static size_t writeCapacity(RingBufferSpsc *rb, size_t wpos, size_t len) {
+    return (size_t)RINGBUFFERWRAP_WRITE_CAPACITY(rb->_cap, wpos, rb->_rpos,
+                                                 rb->_rposCache, len);
+}
+
+// Returns the consumer's read capacity, only loading the producer's write index
+// if the cached copy does not hold len bytes.
+static size_t readCapacity(RingBufferSpsc *rb, size_t rpos, size_t len) {
+    return (size_t)RINGBUFFERWRAP_READ_CAPACITY(rb->_cap, rpos, rb->_wpos,
+                                                rb->_wposCache, len);
+}
+
+// Returns a monotonic time in nanoseconds.
+static uint64_t now(void) {
+    struct timespec ts;
+#ifdef __linux__
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#else
+    timespec_get(&ts, TIME_UTC);
+#endif
+    return (uint64_t)ts.tv_sec * NANOSECONDS_PER_SECOND + (uint64_t)ts.tv_nsec;
+}
+
+// Tells the processor that the thread is spinning.
+static void relax(void) {
+#if (defined(__GNUC__) || defined(__clang__)) &&                               \
+    (defined(__x86_64__) || defined(__i386__))
+    __builtin_ia32_pause();
+#endif
+}
+
+// Parks the thread while the waiter flag is set, for at most ns nanoseconds.
+static void park(_Atomic uint32_t *flag, uint64_t ns) {
+#ifdef __linux__
+    struct timespec ts;
+    struct timespec *pts = NULL;
+    if (ns != RINGBUFFERSPSC_WAIT_FOREVER) {
+        ts.tv_sec = (time_t)(ns / NANOSECONDS_PER_SECOND);
+        ts.tv_nsec = (long)(ns % NANOSECONDS_PER_SECOND);
+        pts = &ts;
+    }
+    syscall(SYS_futex, (uint32_t *)flag, FUTEX_WAIT_PRIVATE, 1, pts, NULL, 0);
+#else
+    // Falls back on yielding where futexes are not available.
+    (void)flag;
+    (void)ns;
+#ifndef __STDC_NO_THREADS__
+    thrd_yield();
+#endif
+#endif
+}
+
+// Wakes the thread parked on the waiter flag, if any.
+static void unpark(_Atomic uint32_t *flag) {
+    if (atomic_load_explicit(flag, memory_order_relaxed) != 0) {
+        atomic_store_explicit(flag, 0, memory_order_relaxed);
+#ifdef __linux__
+        syscall(SYS_futex, (uint32_t *)flag, FUTEX_WAKE_PRIVATE, 1, NULL,
+                NULL, 0);
+#endif
+    }
+}
+
+#ifdef __linux__
+// Signals the event file descriptor.
+static void signalEvent(int fd) {
+    uint64_t one = 1;
+    // Only fails if the counter is about to overflow, when it stays readable.
+    ssize_t ret = write(fd, &one, sizeof(one));
+    (void)ret;
+}
+#endif
+
+// Notifies the consumer after the producer published bytes written from the
+// old write index.
+//
+// The fence pairs with the one in waitFor() or notifyProducer(), so that either
+// the consumer sees the new write index or the producer sees the waiter flag
+// or the read index that the consumer published before checking.
+static void notifyConsumer(RingBufferSpsc *rb, size_t wpos) {
+    if (!rb->_wait && (rb->_readEventFd < 0)) {
+        return;
+    }
+    atomic_thread_fence(memory_order_seq_cst);
+    if (rb->_wait) {
+        unpark(&rb->_rwait);
+    }
+#ifdef __linux__
+    if ((rb->_readEventFd >= 0) &&
+        (atomic_load_explicit(&rb->_rpos, memory_order_relaxed) == wpos)) {
+        signalEvent(rb->_readEventFd);
+    }
+#else
+    (void)wpos;
+#endif
+}
+
+// Notifies the producer after the consumer published bytes read from the old
+// read index.
+static void notifyProducer(RingBufferSpsc *rb, size_t rpos) {
+    if (!rb->_wait && (rb->_writeEventFd < 0)) {
+        return;
+    }
+    atomic_thread_fence(memory_order_seq_cst);
+    if (rb->_wait) {
+        unpark(&rb->_wwait);
+    }
+#ifdef __linux__
+    size_t wpos = atomic_load_explicit(&rb->_wpos, memory_order_relaxed);
+    if ((rb->_writeEventFd >= 0) &&
+        (RingBufferWrap_used(rb->_cap, wpos, rpos) == rb->_cap)) {
+        signalEvent(rb->_writeEventFd);
+    }
+#else
+    (void)rpos;
+#endif
+}
+
+// Waits until the transfer makes progress, spinning first and then parking on
+// the waiter flag, and returns the number of bytes transferred or zero if the
+// timeout expired.
+static size_t waitFor(RingBufferSpsc *rb, _Atomic uint32_t *flag,
+                      size_t (*transfer)(RingBufferSpsc *, void *, size_t),
+                      size_t (*capacity)(RingBufferSpsc *), void *buf,
+                      size_t len, uint64_t timeout) {
+    uint64_t start = 0;
+    if ((timeout != 0) && (timeout != RINGBUFFERSPSC_WAIT_FOREVER)) {
+        start = now();
+    }
+    for (unsigned spin = 0;; ++spin) {
+        size_t n = transfer(rb, buf, len);
+        if (n > 0) {
+            return n;
+        }
+        if (spin < rb->_spin) {
+            relax();
+            continue;
+        }
+        uint64_t left = timeout;
+        if ((timeout != 0) && (timeout != RINGBUFFERSPSC_WAIT_FOREVER)) {
+            uint64_t elapsed = now() - start;
+            left = (elapsed < timeout) ? (timeout - elapsed) : 0;
+        }
+        if (left == 0) {
+            return 0;
+        }
+        atomic_store_explicit(flag, 1, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        if (capacity(rb) == 0) {
+            park(flag, left);
+        }
+        atomic_store_explicit(flag, 0, memory_order_relaxed);
+    }
+}
+
+// Adapts RingBufferSpsc_writeBytes() to waitFor().
+static size_t writeBytes(RingBufferSpsc *rb, void *buf, size_t len) {
+    return RingBufferSpsc_writeBytes(rb, buf, len);
+}
+
+bool RingBufferSpsc_initializeWaitable(RingBufferSpsc *rb, void *data,
+                                       size_t cap, unsigned spin) {
+    if (!RingBufferSpsc_initialize(rb, data, cap)) {
+        return false;
+    }
+    rb->_spin = spin;
+    rb->_wait = true;
+    return true;
+}
+
+size_t RingBufferSpsc_getWriteByteCapacity(RingBufferSpsc *rb) {
+    if (rb == NULL) {
+        return 0;
+    }
+    size_t wpos = atomic_load_explicit(&rb->_wpos, memory_order_relaxed);
+    return writeCapacity(rb, wpos, rb->_cap);
+}
+
+size_t RingBufferSpsc_getReadByteCapacity(RingBufferSpsc *rb) {
+    if (rb == NULL) {
+        return 0;
+    }
+    size_t rpos = atomic_load_explicit(&rb->_rpos, memory_order_relaxed);
+    return readCapacity(rb, rpos, rb->_cap);
+}
+
+size_t RingBufferSpsc_getWriteByteSpan(RingBufferSpsc *rb) {
+    if (rb == NULL) {
+        return 0;
+    }
+    size_t wpos = atomic_load_explicit(&rb->_wpos, memory_order_relaxed);
+    size_t wcap = writeCapacity(rb, wpos, rb->_cap);
+    size_t off = RingBufferWrap_offset(rb->_cap, wpos);
+    return ((off + wcap) >= rb->_cap) ? (rb->_cap - off) : wcap;
+}
+
+size_t RingBufferSpsc_getReadByteSpan(RingBufferSpsc *rb) {
+    if (rb == NULL) {
+        return 0;
+    }
+    size_t rpos = atomic_load_explicit(&rb->_rpos, memory_order_relaxed);
+    size_t rcap = readCapacity(rb, rpos, rb->_cap);
+    size_t off = RingBufferWrap_offset(rb->_cap, rpos);
+    return ((off + rcap) >= rb->_cap) ? (rb->_cap - off) : rcap;
+}
+
+size_t RingBufferSpsc_writeBytes(RingBufferSpsc *rb, const void *buf,
+                                 size_t len) {
+    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    size_t wpos = atomic_load_explicit(&rb->_wpos, memory_order_relaxed);
+    size_t wcap = writeCapacity(rb, wpos, len);
+    if (len > wcap) {
+        len = wcap;
+    }
+    RingBufferWrap_copyIn(rb->_data, rb->_cap, wpos, (const uint8_t *)buf, len);
+    atomic_store_explicit(&rb->_wpos,
+                          RingBufferWrap_advance(rb->_cap, wpos, len),
+                          memory_order_release);
+    notifyConsumer(rb, wpos);
+    return len;
+}
+
+size_t RingBufferSpsc_discardBytes(RingBufferSpsc *rb, size_t len) {
+    if ((rb == NULL) || (len == 0)) {
+        return 0;
+    }
+    size_t rpos = atomic_load_explicit(&rb->_rpos, memory_order_relaxed);
+    size_t rcap = readCapacity(rb, rpos, len);
+    if (len > rcap) {
+        len = rcap;
+    }
+    atomic_store_explicit(&rb->_rpos,
+                          RingBufferWrap_advance(rb->_cap, rpos, len),
+                          memory_order_release);
+    notifyProducer(rb, rpos);
+    return len;
+}
+
+size_t RingBufferSpsc_readBytes(RingBufferSpsc *rb, void *buf, size_t len) {
+    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    size_t rpos = atomic_load_explicit(&rb->_rpos, memory_order_relaxed);
+    size_t rcap = readCapacity(rb, rpos, len);
+    if (len > rcap) {
+        len = rcap;
+    }
+    RingBufferWrap_copyOut(rb->_data, rb->_cap, rpos, (uint8_t *)buf, len);
+    atomic_store_explicit(&rb->_rpos,
+                          RingBufferWrap_advance(rb->_cap, rpos, len),
+                          memory_order_release);
+    notifyProducer(rb, rpos);
+    return len;
+}
+
+size_t RingBufferSpsc_peekBytes(RingBufferSpsc *rb, void *buf, size_t len) {
+    return RingBufferSpsc_peekBytesAt(rb, 0, buf, len);
+}
+
+size_t RingBufferSpsc_peekBytesAt(RingBufferSpsc *rb, size_t pos, void *buf,
+                                  size_t len) {
+    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    size_t rpos = atomic_load_explicit(&rb->_rpos, memory_order_relaxed);
+    size_t need = rb->_cap;
+    if ((pos < rb->_cap) && (len < (rb->_cap - pos))) {
+        need = pos + len;
+    }
+    size_t rcap = readCapacity(rb, rpos, need);
+    if (pos >= rcap) {
+        return 0;
+    }
+    rcap -= pos;
+    if (len > rcap) {
+        len = rcap;
+    }
+    RingBufferWrap_copyOut(rb->_data, rb->_cap,
+                           RingBufferWrap_advance(rb->_cap, rpos, pos),
+                           (uint8_t *)buf, len);
+    return len;
+}
+
+size_t RingBufferSpsc_writeBytesWait(RingBufferSpsc *rb, const void *buf,
+                                     size_t len, uint64_t timeout) {
+    if ((rb == NULL) || !rb->_wait || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    return waitFor(rb, &rb->_wwait, writeBytes,
+                   RingBufferSpsc_getWriteByteCapacity, (void *)buf, len,
+                   timeout);
+}
+
+size_t RingBufferSpsc_readBytesWait(RingBufferSpsc *rb, void *buf, size_t len,
+                                    uint64_t timeout) {
+    if ((rb == NULL) || !rb->_wait || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    return waitFor(rb, &rb->_rwait, RingBufferSpsc_readBytes,
+                   RingBufferSpsc_getReadByteCapacity, buf, len, timeout);
+}
+
+bool RingBufferSpscWriteBatch_initialize(RingBufferSpscWriteBatch *wb,
+                                         RingBufferSpsc *rb, size_t threshold) {
+    if ((wb == NULL) || (rb == NULL)) {
+        return false;
+    }
+    wb->_rb = rb;
+    wb->_wpos = atomic_load_explicit(&rb->_wpos, memory_order_relaxed);
+    wb->_pend = 0;
+    wb->_threshold = threshold;
+    return true;
+}
+
+size_t RingBufferSpscWriteBatch_writeBytes(RingBufferSpscWriteBatch *wb,
+                                           const void *buf, size_t len) {
+    if ((wb == NULL) || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    RingBufferSpsc *rb = wb->_rb;
+    size_t wcap = writeCapacity(rb, wb->_wpos, len);
+    if (len > wcap) {
+        len = wcap;
+    }
+    RingBufferWrap_copyIn(rb->_data, rb->_cap, wb->_wpos, (const uint8_t *)buf,
+                          len);
+    wb->_wpos = RingBufferWrap_advance(rb->_cap, wb->_wpos, len);
+    wb->_pend += len;
+    if ((wb->_threshold > 0) && (wb->_pend >= wb->_threshold)) {
+        RingBufferSpscWriteBatch_flush(wb);
+    }
+    return len;
+}
+
+size_t RingBufferSpscWriteBatch_flush(RingBufferSpscWriteBatch *wb) {
+    if ((wb == NULL) || (wb->_pend == 0)) {
+        return 0;
+    }
+    RingBufferSpsc *rb = wb->_rb;
+    size_t wpos = atomic_load_explicit(&rb->_wpos, memory_order_relaxed);
+    atomic_store_explicit(&rb->_wpos, wb->_wpos, memory_order_release);
+    notifyConsumer(rb, wpos);
+    size_t len = wb->_pend;
+    wb->_pend = 0;
+    return len;
+}
+
+bool RingBufferSpscReadBatch_initialize(RingBufferSpscReadBatch *rd,
+                                        RingBufferSpsc *rb, size_t threshold) {
+    if ((rd == NULL) || (rb == NULL)) {
+        return false;
+    }
+    rd->_rb = rb;
+    rd->_rpos = atomic_load_explicit(&rb->_rpos, memory_order_relaxed);
+    rd->_pend = 0;
+    rd->_threshold = threshold;
+    return true;
+}
+
+size_t RingBufferSpscReadBatch_discardBytes(RingBufferSpscReadBatch *rd,
+                                            size_t len) {
+    if ((rd == NULL) || (len == 0)) {
+        return 0;
+    }
+    RingBufferSpsc *rb = rd->_rb;
+    size_t rcap = readCapacity(rb, rd->_rpos, len);
+    if (len > rcap) {
+        len = rcap;
+    }
+    rd->_rpos = RingBufferWrap_advance(rb->_cap, rd->_rpos, len);
+    rd->_pend += len;
+    if ((rd->_threshold > 0) && (rd->_pend >= rd->_threshold)) {
+        RingBufferSpscReadBatch_flush(rd);
+    }
+    return len;
+}
+
+size_t RingBufferSpscReadBatch_readBytes(RingBufferSpscReadBatch *rd,
+                                         void *buf, size_t len) {
+    if ((rd == NULL) || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    size_t rcap = readCapacity(rd->_rb, rd->_rpos, len);
+    if (len > rcap) {
+        len = rcap;
+    }
+    RingBufferWrap_copyOut(rd->_rb->_data, rd->_rb->_cap, rd->_rpos,
+                           (uint8_t *)buf, len);
+    return RingBufferSpscReadBatch_discardBytes(rd, len);
+}
+
+size_t RingBufferSpscReadBatch_flush(RingBufferSpscReadBatch *rd) {
+    if ((rd == NULL) || (rd->_pend == 0)) {
+        return 0;
+    }
+    RingBufferSpsc *rb = rd->_rb;
+    size_t rpos = atomic_load_explicit(&rb->_rpos, memory_order_relaxed);
+    atomic_store_explicit(&rb->_rpos, rd->_rpos, memory_order_release);
+    notifyProducer(rb, rpos);
+    size_t len = rd->_pend;
+    rd->_pend = 0;
+    return len;
+}
+
+#ifdef __linux__
+bool RingBufferSpsc_openEventFds(RingBufferSpsc *rb) {
+    if ((rb == NULL) || (rb->_readEventFd >= 0) || (rb->_writeEventFd >= 0)) {
+        errno = EINVAL;
+        return false;
+    }
+    int rfd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (rfd < 0) {
+        return false;
+    }
+    int wfd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (wfd < 0) {
+        int err = errno;
+        close(rfd);
+        errno = err;
+        return false;
+    }
+    rb->_readEventFd = rfd;
+    rb->_writeEventFd = wfd;
+    // Signals the current readiness, as the edges so far were not signaled.
+    size_t wpos = atomic_load_explicit(&rb->_wpos, memory_order_relaxed);
+    size_t rpos = atomic_load_explicit(&rb->_rpos, memory_order_relaxed);
+    size_t used = RingBufferWrap_used(rb->_cap, wpos, rpos);
+    if (used > 0) {
+        signalEvent(rfd);
+    }
+    if (used < rb->_cap) {
+        signalEvent(wfd);
+    }
+    return true;
+}
+
+bool RingBufferSpsc_closeEventFds(RingBufferSpsc *rb) {
+    if (rb == NULL) {
+        return false;
+    }
+    if (rb->_readEventFd >= 0) {
+        close(rb->_readEventFd);
+        rb->_readEventFd = -1;
+    }
+    if (rb->_writeEventFd >= 0) {
+        close(rb->_writeEventFd);
+        rb->_writeEventFd = -1;
+    }
+    return true;
+}
+
+bool RingBufferSpsc_acknowledgeEvent(int fd) {
+    uint64_t count;
+    return (fd >= 0) && (read(fd, &count, sizeof(count)) == sizeof(count));
+}
+#endif
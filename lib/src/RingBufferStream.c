@@ -0,0 +1,108 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Implements RingBufferStream and associated functions.
+ */
+
+#ifndef _RINGBUFFERSTREAM_C
+#define _RINGBUFFERSTREAM_C
+
+#include "RingBufferStream.h"
+
+#ifndef RINGBUFFER_HEADER_ONLY
+extern inline bool RingBufferStream_initialize(RingBufferStream *rb, void *data,
+                                               size_t cap);
+extern inline bool RingBufferStream_reset(RingBufferStream *rb);
+extern inline size_t
+RingBufferStream_getByteCapacity(const RingBufferStream *rb);
+extern inline size_t
+RingBufferStream_getWriteByteCapacity(const RingBufferStream *rb);
+extern inline size_t
+RingBufferStream_getDeliverByteCapacity(const RingBufferStream *rb);
+extern inline uint64_t
+RingBufferStream_getWriteOffset(const RingBufferStream *rb);
+extern inline uint64_t
+RingBufferStream_getDeliverOffset(const RingBufferStream *rb);
+extern inline uint64_t
+RingBufferStream_getAcknowledgeOffset(const RingBufferStream *rb);
+#endif
+
+size_t RingBufferStream_writeBytes(RingBufferStream *rb, const void *buf,
+                                   size_t len) {
+    return (rb != NULL) ? RingBuffer_writeBytes(&rb->_rb, buf, len) : 0;
+}
+
+size_t RingBufferStream_deliverBytes(RingBufferStream *rb, void *buf,
+                                     size_t len) {
+    if (rb == NULL) {
+        return 0;
+    }
+    size_t pos = (size_t)(rb->_dlv - rb->_ack);
+    size_t copied = RingBuffer_peekBytesAt(&rb->_rb, pos, buf, len);
+    rb->_dlv += copied;
+    return copied;
+}
+
+size_t RingBufferStream_peekBytesAt(const RingBufferStream *rb, uint64_t off,
+                                    void *buf, size_t len) {
+    if ((rb == NULL) || (off < rb->_ack) ||
+        (off >= RingBufferStream_getWriteOffset(rb))) {
+        return 0;
+    }
+    return RingBuffer_peekBytesAt(&rb->_rb, (size_t)(off - rb->_ack), buf,
+                                  len);
+}
+
+size_t RingBufferStream_peekSegmentsAt(const RingBufferStream *rb,
+                                       uint64_t off, RingBufferSegment seg[2],
+                                       size_t len) {
+    if ((rb == NULL) || (off < rb->_ack) ||
+        (off >= RingBufferStream_getWriteOffset(rb))) {
+        return 0;
+    }
+    return RingBuffer_peekSegmentsAt(&rb->_rb, (size_t)(off - rb->_ack), seg,
+                                     len);
+}
+
+bool RingBufferStream_rewind(RingBufferStream *rb, uint64_t off) {
+    if ((rb == NULL) || (off < rb->_ack) ||
+        (off > RingBufferStream_getWriteOffset(rb))) {
+        return false;
+    }
+    rb->_dlv = off;
+    return true;
+}
+
+size_t RingBufferStream_acknowledge(RingBufferStream *rb, uint64_t off) {
+    if ((rb == NULL) || (off <= rb->_ack) || (off > rb->_dlv)) {
+        return 0;
+    }
+    size_t len = RingBuffer_discardBytes(&rb->_rb, (size_t)(off - rb->_ack));
+    rb->_ack = off;
+    return len;
+}
+
+#endif // _RINGBUFFERSTREAM_C
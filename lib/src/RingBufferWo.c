@@ -27,28 +27,69 @@ SOFTWARE.
  * Implements RingBufferWo and associated functions.
  */
 
+#ifndef _RINGBUFFERWO_C
+#define _RINGBUFFERWO_C
+
 #include "RingBufferWo.h"
-#include <string.h>
+#include "RingBufferCopy.h"
+
+#ifndef RINGBUFFER_HEADER_ONLY
+extern inline bool RingBufferWo_initialize(RingBufferWo *rb, void *data,
+                                           size_t cap);
+extern inline bool RingBufferWo_reset(RingBufferWo *rb);
+extern inline void *RingBufferWo_getDataPointer(const RingBufferWo *rb);
+extern inline size_t RingBufferWo_getByteCapacity(const RingBufferWo *rb);
+extern inline size_t RingBufferWo_getWriteBytePosition(const RingBufferWo *rb);
+#endif
+
+// Wraps the write position with the mask and copies the last capacity bytes
+// at most, in two pieces, the second of which is usually empty.
+static size_t Wo_writeBytesPow2(RingBufferWo *rb, const uint8_t *tbuf,
+                                size_t len) {
+    size_t left = len;
+    size_t wpos = rb->_wpos;
+    if (left > rb->_cap) {
+        size_t skip = left - rb->_cap;
+        tbuf += skip;
+        left -= skip;
+        wpos = (wpos + skip) & rb->_mask;
+    }
+    size_t first = rb->_cap - wpos;
+    if (left < first) {
+        first = left;
+    }
+    RingBufferCopy_copy(rb->_data + wpos, tbuf, first);
+    if (left > first) {
+        RingBufferCopy_copy(rb->_data, tbuf + first, left - first);
+    }
+    rb->_wpos = (wpos + left) & rb->_mask;
+    return len;
+}
 
 size_t RingBufferWo_writeBytes(RingBufferWo *rb, const void *buf, size_t len) {
-    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+    if (RINGBUFFER_ISNULL(rb) || RINGBUFFER_ISNULL(buf) || (len == 0)) {
         return 0;
     }
     const uint8_t *tbuf = (uint8_t *)buf;
+    if (rb->_mask != 0) {
+        return Wo_writeBytesPow2(rb, tbuf, len);
+    }
     size_t left = len;
     size_t skip = (left > rb->_cap) ? (left / rb->_cap - 1) * rb->_cap : 0;
     tbuf += skip;
     left -= skip;
-    if ((rb->_wpos + left) >= rb->_cap) {
+    while ((rb->_wpos + left) >= rb->_cap) {
         size_t copy = rb->_cap - rb->_wpos;
-        memcpy(rb->_data + rb->_wpos, tbuf, copy);
+        RingBufferCopy_copy(rb->_data + rb->_wpos, tbuf, copy);
         rb->_wpos = 0;
         tbuf += copy;
         left -= copy;
     }
     if (left > 0) {
-        memcpy(rb->_data + rb->_wpos, tbuf, left);
+        RingBufferCopy_copy(rb->_data + rb->_wpos, tbuf, left);
         rb->_wpos += left;
     }
     return len;
 }
+
+#endif // _RINGBUFFERWO_C
@@ -0,0 +1,97 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Implements RingBufferWoSeq and associated functions.
+ */
+
+#include "RingBufferWoSeq.h"
+#include <string.h>
+
+#ifndef RINGBUFFER_HEADER_ONLY
+extern inline bool RingBufferWoSeq_initialize(RingBufferWoSeq *rb, void *data,
+                                              size_t cap);
+extern inline size_t RingBufferWoSeq_getByteCapacity(const RingBufferWoSeq *rb);
+extern inline uint64_t RingBufferWoSeq_getWriteSequence(RingBufferWoSeq *rb);
+#endif
+
+size_t RingBufferWoSeq_writeBytes(RingBufferWoSeq *rb, const void *buf,
+                                  size_t len) {
+    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    uint64_t seq = atomic_load_explicit(&rb->_seq, memory_order_relaxed);
+    // Orders the pending write sequence before the bytes overwritten, so that
+    // a reader seeing any overwritten byte also sees the pending sequence.
+    atomic_store_explicit(&rb->_pend, seq + len, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    len = RingBufferWo_writeBytes(&rb->_wo, buf, len);
+    atomic_store_explicit(&rb->_seq, seq + len, memory_order_release);
+    return len;
+}
+
+size_t RingBufferWoSeq_readBytesAt(RingBufferWoSeq *rb, uint64_t seq,
+                                   void *buf, size_t len, uint64_t *lost) {
+    if (lost != NULL) {
+        *lost = 0;
+    }
+    if ((rb == NULL) || (buf == NULL) || (len == 0)) {
+        return 0;
+    }
+    const uint8_t *data = rb->_wo._data;
+    size_t cap = rb->_wo._cap;
+    for (;;) {
+        uint64_t head = atomic_load_explicit(&rb->_seq, memory_order_acquire);
+        uint64_t from = seq;
+        if ((head > cap) && (from < (head - cap))) {
+            from = head - cap;
+        }
+        uint64_t end = ((seq < head) && (len < (head - seq))) ? (seq + len)
+                                                               : head;
+        if (from >= end) {
+            if (lost != NULL) {
+                *lost = (from > seq) ? (end - seq) : 0;
+            }
+            return 0;
+        }
+        size_t copy = (size_t)(end - from);
+        size_t off = (size_t)(from % cap);
+        if ((off + copy) > cap) {
+            memcpy(buf, data + off, cap - off);
+            memcpy((uint8_t *)buf + (cap - off), data, copy - (cap - off));
+        } else {
+            memcpy(buf, data + off, copy);
+        }
+        atomic_thread_fence(memory_order_acquire);
+        uint64_t pend = atomic_load_explicit(&rb->_pend, memory_order_relaxed);
+        if (pend <= (from + cap)) {
+            if (lost != NULL) {
+                *lost = from - seq;
+            }
+            return copy;
+        }
+        // The writer lapped the bytes during the copy.
+    }
+}
@@ -0,0 +1,138 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/**
+ * @file
+ * Defines the internal index and segment functions of the ring buffers.
+ *
+ * The concurrent ring buffers count their read and write indices modulo twice
+ * the capacity, so that equal indices mean empty and indices a capacity apart
+ * mean full, without a separate length. The indices are 64-bit so that the
+ * same functions serve RingBufferShm, whose layout is shared between processes
+ * of any word size.
+ *
+ * RingBufferWrap_segments() splits a run of bytes at the end of the data
+ * memory into the one or two regions that the segment functions return, and
+ * RingBufferWrap_copyIn() and RingBufferWrap_copyOut() copy a run of bytes
+ * that may cross it.
+ */
+
+// Included ahead of the guard, because in a header-only build RingBuffer.h
+// includes RingBuffer.c, which includes this header, and must declare
+// RingBufferSegment before it does.
+#include "RingBuffer.h"
+
+#ifndef _RINGBUFFERWRAP_H
+#define _RINGBUFFERWRAP_H
+
+#include <stdatomic.h>
+#include <string.h>
+
+// Returns the number of bytes between the read index and the write index.
+static inline uint64_t RingBufferWrap_used(uint64_t cap, uint64_t wpos,
+                                           uint64_t rpos) {
+    return (wpos >= rpos) ? (wpos - rpos) : (wpos + 2 * cap - rpos);
+}
+
+// Returns the index advanced by len bytes, where len is at most the capacity.
+static inline uint64_t RingBufferWrap_advance(uint64_t cap, uint64_t pos,
+                                              uint64_t len) {
+    pos += len;
+    return (pos >= 2 * cap) ? (pos - 2 * cap) : pos;
+}
+
+// Returns the data memory offset of the index.
+static inline size_t RingBufferWrap_offset(uint64_t cap, uint64_t pos) {
+    return (size_t)((pos >= cap) ? (pos - cap) : pos);
+}
+
+// Fills the segments with the len bytes at the data memory offset, splitting
+// them where they cross the end offset, which is the capacity, or twice the
+// capacity for mirrored data memory.
+static inline void RingBufferWrap_segments(uint8_t *data, size_t end,
+                                           size_t off, size_t len,
+                                           RingBufferSegment seg[2]) {
+    seg[0].data = data + off;
+    seg[1].data = data;
+    if ((off + len) > end) {
+        seg[0].len = end - off;
+        seg[1].len = len - seg[0].len;
+    } else {
+        seg[0].len = len;
+        seg[1].len = 0;
+    }
+}
+
+// Evaluates to the producer's write capacity at the write index, only loading
+// the consumer's atomic read index into its cached copy if the cached copy does
+// not leave room for len bytes. A macro, like RINGBUFFERWRAP_READ_CAPACITY(),
+// so that it serves atomic indices of any width.
+#define RINGBUFFERWRAP_WRITE_CAPACITY(cap, wpos, rpos, rposCache, len)        \
+    ((((cap) - RingBufferWrap_used((cap), (wpos), (rposCache))) >= (len))     \
+         ? ((cap) - RingBufferWrap_used((cap), (wpos), (rposCache)))          \
+         : ((rposCache) = atomic_load_explicit(&(rpos), memory_order_acquire), \
+            (cap) - RingBufferWrap_used((cap), (wpos), (rposCache))))
+
+// Evaluates to the consumer's read capacity at the read index, only loading the
+// producer's atomic write index into its cached copy if the cached copy does
+// not hold len bytes.
+#define RINGBUFFERWRAP_READ_CAPACITY(cap, rpos, wpos, wposCache, len)         \
+    ((RingBufferWrap_used((cap), (wposCache), (rpos)) >= (len))               \
+         ? RingBufferWrap_used((cap), (wposCache), (rpos))                    \
+         : ((wposCache) = atomic_load_explicit(&(wpos), memory_order_acquire), \
+            RingBufferWrap_used((cap), (wposCache), (rpos))))
+
+// Copies len bytes from the source to the data memory at the index, where len
+// is at most the capacity.
+static inline void RingBufferWrap_copyIn(uint8_t *data, size_t cap,
+                                         uint64_t pos, const uint8_t *tbuf,
+                                         size_t len) {
+    size_t off = RingBufferWrap_offset(cap, pos);
+    if ((off + len) > cap) {
+        size_t copy = cap - off;
+        memcpy(data + off, tbuf, copy);
+        tbuf += copy;
+        len -= copy;
+        off = 0;
+    }
+    memcpy(data + off, tbuf, len);
+}
+
+// Copies len bytes from the data memory at the index to the destination, where
+// len is at most the capacity.
+static inline void RingBufferWrap_copyOut(const uint8_t *data, size_t cap,
+                                          uint64_t pos, uint8_t *tbuf,
+                                          size_t len) {
+    size_t off = RingBufferWrap_offset(cap, pos);
+    if ((off + len) > cap) {
+        size_t copy = cap - off;
+        memcpy(tbuf, data + off, copy);
+        tbuf += copy;
+        len -= copy;
+        off = 0;
+    }
+    memcpy(tbuf, data + off, len);
+}
+
+#endif // _RINGBUFFERWRAP_H
@@ -0,0 +1,211 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "RingBufferBroadcast.h"
+#include "RingBufferTests.h"
+#include "test.h"
+#include <stdio.h>
+#include <string.h>
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+
+#define BUFF_SIZE 15
+#define READER_COUNT 3
+#define WRITE_STRING "Hello, world!\n"
+#define TRANSFER_SIZE 100000
+
+#ifndef __STDC_NO_THREADS__
+typedef struct {
+    RingBufferBroadcast *rb;
+    size_t reader;
+    bool success;
+} Broadcast_Consumer;
+
+static int Broadcast_produce(void *arg) {
+    RingBufferBroadcast *rb = (RingBufferBroadcast *)arg;
+    uint8_t value = 0;
+    for (size_t n = 0; n < TRANSFER_SIZE;) {
+        uint8_t chunk[7];
+        size_t len = (TRANSFER_SIZE - n < sizeof(chunk)) ? (TRANSFER_SIZE - n)
+                                                         : sizeof(chunk);
+        for (size_t i = 0; i < len; ++i) {
+            chunk[i] = (uint8_t)(value + i);
+        }
+        size_t written = RingBufferBroadcast_writeBytes(rb, chunk, len);
+        if (written == 0) {
+            thrd_yield();
+        }
+        value = (uint8_t)(value + written);
+        n += written;
+    }
+    return 0;
+}
+
+static int Broadcast_consume(void *arg) {
+    Broadcast_Consumer *consumer = (Broadcast_Consumer *)arg;
+    uint8_t value = 0;
+    consumer->success = true;
+    for (size_t n = 0; n < TRANSFER_SIZE;) {
+        // Each consumer reads at its own pace.
+        RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+        size_t len = RingBufferBroadcast_peekSegments(
+            consumer->rb, consumer->reader, seg, 3 + 4 * consumer->reader);
+        if (len == 0) {
+            thrd_yield();
+        }
+        for (size_t s = 0; s < 2; ++s) {
+            for (size_t i = 0; (len > 0) && (i < seg[s].len); ++i) {
+                consumer->success =
+                    consumer->success && (seg[s].data[i] == value++);
+            }
+        }
+        n += RingBufferBroadcast_consumeBytes(consumer->rb, consumer->reader,
+                                              len);
+    }
+    return 0;
+}
+#endif
+
+bool RingBufferBroadcast_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    char buff[BUFF_SIZE];
+    char buff_read[BUFF_SIZE];
+    char buff_writeBytes[BUFF_SIZE];
+    RingBufferBroadcastReader readers[READER_COUNT];
+    RingBufferBroadcast rb;
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+
+    strncpy_s(buff_writeBytes, BUFF_SIZE, WRITE_STRING, strlen(WRITE_STRING));
+
+    TEST(!RingBufferBroadcast_initialize(NULL, buff, BUFF_SIZE, readers,
+                                         READER_COUNT));
+    TEST(!RingBufferBroadcast_initialize(&rb, NULL, BUFF_SIZE, readers,
+                                         READER_COUNT));
+    TEST(!RingBufferBroadcast_initialize(&rb, buff, 0, readers,
+                                         READER_COUNT));
+    TEST(!RingBufferBroadcast_initialize(&rb, buff, SIZE_MAX, readers,
+                                         READER_COUNT));
+    TEST(!RingBufferBroadcast_initialize(&rb, buff, BUFF_SIZE, NULL,
+                                         READER_COUNT));
+    TEST(!RingBufferBroadcast_initialize(&rb, buff, BUFF_SIZE, readers, 0));
+    TEST(RingBufferBroadcast_initialize(&rb, buff, BUFF_SIZE, readers,
+                                        READER_COUNT));
+    TEST(RingBufferBroadcast_getDataPointer(&rb) == buff);
+    TEST(RingBufferBroadcast_getByteCapacity(&rb) == BUFF_SIZE);
+    TEST(RingBufferBroadcast_getReaderCount(&rb) == READER_COUNT);
+    TEST(RingBufferBroadcast_getWriteByteCapacity(&rb) == BUFF_SIZE);
+
+    TEST(RingBufferBroadcast_getDataPointer(NULL) == NULL);
+    TEST(RingBufferBroadcast_getByteCapacity(NULL) == 0);
+    TEST(RingBufferBroadcast_getReaderCount(NULL) == 0);
+    TEST(RingBufferBroadcast_getWriteByteCapacity(NULL) == 0);
+    TEST(RingBufferBroadcast_writeBytes(NULL, buff_writeBytes, 1) == 0);
+    TEST(RingBufferBroadcast_writeBytes(&rb, NULL, 1) == 0);
+    TEST(RingBufferBroadcast_getReadByteCapacity(NULL, 0) == 0);
+    TEST(RingBufferBroadcast_peekSegments(NULL, 0, seg, 1) == 0);
+    TEST(RingBufferBroadcast_peekSegments(&rb, 0, NULL, 1) == 0);
+    TEST(RingBufferBroadcast_consumeBytes(NULL, 0, 1) == 0);
+    TEST(RingBufferBroadcast_readBytes(NULL, 0, buff_read, 1) == 0);
+    TEST(RingBufferBroadcast_readBytes(&rb, 0, NULL, 1) == 0);
+    RingBufferBroadcast_writeBytes(&rb, buff_writeBytes, 1);
+    TEST(RingBufferBroadcast_getReadByteCapacity(&rb, READER_COUNT) == 0);
+    TEST(RingBufferBroadcast_peekSegments(&rb, READER_COUNT, seg, 1) == 0);
+    TEST(RingBufferBroadcast_consumeBytes(&rb, READER_COUNT, 1) == 0);
+    TEST(RingBufferBroadcast_readBytes(&rb, READER_COUNT, buff_read, 1) == 0);
+
+    for (size_t n = 0; n <= BUFF_SIZE; ++n) {
+        for (size_t p = 0; p <= BUFF_SIZE; ++p) {
+            // Starts each round at a different write position to wrap.
+            RingBufferBroadcast_initialize(&rb, buff, BUFF_SIZE, readers,
+                                           READER_COUNT);
+            RingBufferBroadcast_writeBytes(&rb, buff_writeBytes, p);
+            for (size_t r = 0; r < READER_COUNT; ++r) {
+                RingBufferBroadcast_consumeBytes(&rb, r, p);
+            }
+
+            TEST(RingBufferBroadcast_writeBytes(&rb, buff_writeBytes,
+                                                BUFF_SIZE) == BUFF_SIZE);
+            TEST(RingBufferBroadcast_getWriteByteCapacity(&rb) == 0);
+
+            // The slowest consumer bounds the room left for the producer.
+            for (size_t r = 0; r < READER_COUNT; ++r) {
+                TEST(RingBufferBroadcast_getReadByteCapacity(&rb, r) ==
+                     BUFF_SIZE);
+                TEST(RingBufferBroadcast_peekSegments(&rb, r, seg, n) == n);
+                if (n > 0) {
+                    TEST(seg[0].len + seg[1].len == n);
+                    TEST(seg[0].len ==
+                         ((n < (BUFF_SIZE - p % BUFF_SIZE))
+                              ? n
+                              : (BUFF_SIZE - p % BUFF_SIZE)));
+                    TEST(memcmp(seg[0].data, buff_writeBytes, seg[0].len) ==
+                         0);
+                    TEST(memcmp(seg[1].data, &buff_writeBytes[seg[0].len],
+                                seg[1].len) == 0);
+                }
+                TEST(RingBufferBroadcast_consumeBytes(&rb, r, n + r) ==
+                     ((n + r < BUFF_SIZE) ? (n + r) : BUFF_SIZE));
+            }
+            TEST(RingBufferBroadcast_getWriteByteCapacity(&rb) == n);
+
+            memset(buff_read, 0, BUFF_SIZE);
+            TEST(RingBufferBroadcast_readBytes(&rb, 0, buff_read, BUFF_SIZE) ==
+                 (BUFF_SIZE - n));
+            TEST(strncmp(buff_read, &buff_writeBytes[n], BUFF_SIZE - n) == 0);
+            TEST(RingBufferBroadcast_getReadByteCapacity(&rb, 0) == 0);
+            TEST(RingBufferBroadcast_getWriteByteCapacity(&rb) ==
+                 ((n + 1 < BUFF_SIZE) ? (n + 1) : BUFF_SIZE));
+        }
+    }
+
+#ifndef __STDC_NO_THREADS__
+    {
+        thrd_t producer;
+        thrd_t threads[READER_COUNT];
+        Broadcast_Consumer consumers[READER_COUNT];
+        RingBufferBroadcast_initialize(&rb, buff, BUFF_SIZE, readers,
+                                       READER_COUNT);
+        for (size_t r = 0; r < READER_COUNT; ++r) {
+            consumers[r].rb = &rb;
+            consumers[r].reader = r;
+            TEST(thrd_create(&threads[r], Broadcast_consume, &consumers[r]) ==
+                 thrd_success);
+        }
+        TEST(thrd_create(&producer, Broadcast_produce, &rb) == thrd_success);
+        TEST(thrd_join(producer, NULL) == thrd_success);
+        for (size_t r = 0; r < READER_COUNT; ++r) {
+            TEST(thrd_join(threads[r], NULL) == thrd_success);
+            TEST(consumers[r].success);
+        }
+    }
+#endif
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
@@ -0,0 +1,216 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "RingBufferTests.h"
+#include "RingBuffer.hpp"
+extern "C" {
+#include "test.h"
+}
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <string>
+
+namespace {
+
+// Counts its live instances.
+struct Tracked {
+    static int live;
+    int value;
+
+    explicit Tracked(int v) : value(v) { ++live; }
+    Tracked(const Tracked &other) : value(other.value) { ++live; }
+    Tracked(Tracked &&other) noexcept : value(other.value) {
+        other.value = -1;
+        ++live;
+    }
+    Tracked &operator=(const Tracked &other) = default;
+    Tracked &operator=(Tracked &&other) noexcept {
+        value = other.value;
+        other.value = -1;
+        return *this;
+    }
+    ~Tracked() { --live; }
+};
+
+int Tracked::live = 0;
+
+template <typename T>
+bool Cpp_holds(const ringbuffer::SpanPair<T> &seg, int first,
+               std::size_t len) {
+    if ((seg.first.size() + seg.second.size()) != len) {
+        return false;
+    }
+    for (std::size_t i = 0; i < len; ++i) {
+        int value = (i < seg.first.size())
+                        ? seg.first[i]
+                        : seg.second[i - seg.first.size()];
+        if (value != (first + static_cast<int>(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+bool RingBufferCpp_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    {
+        // Non-trivial elements are constructed, moved and destroyed in
+        // place.
+        ringbuffer::RingBuffer<Tracked, 3> rb;
+        TEST(rb.capacity() == 3);
+        TEST(rb.empty() && !rb.full() && (rb.size() == 0));
+        TEST(!rb.pop());
+        Tracked t(7);
+        TEST(!rb.pop(t) && (t.value == 7));
+        TEST(rb.emplace(1)->value == 1);
+        TEST(rb.push(Tracked(2)));
+        TEST(rb.push(t) && (t.value == 7));
+        TEST(!rb.push(Tracked(4)));
+        TEST(rb.emplace(4) == nullptr);
+        TEST(rb.full() && (rb.size() == 3) && (Tracked::live == 4));
+        TEST((rb.front().value == 1) && (rb.back().value == 7));
+        TEST(rb.pop(t) && (t.value == 1) && (Tracked::live == 3));
+        TEST(rb.push(Tracked(8)));
+        TEST((rb[0].value == 2) && (rb[1].value == 7) && (rb[2].value == 8));
+
+        ringbuffer::RingBuffer<Tracked, 3> copy(rb);
+        TEST((copy.size() == 3) && (copy[2].value == 8));
+        TEST(Tracked::live == 7);
+        ringbuffer::RingBuffer<Tracked, 3> moved(std::move(copy));
+        TEST(copy.empty() && (moved.size() == 3) && (moved[0].value == 2));
+        TEST(Tracked::live == 7);
+        copy = moved;
+        TEST((copy.size() == 3) && (Tracked::live == 10));
+        moved = std::move(copy);
+        TEST(copy.empty() && (moved[1].value == 7) && (Tracked::live == 7));
+        TEST(rb.consume(5) == 3);
+        TEST(rb.empty() && (Tracked::live == 4));
+        moved.clear();
+        TEST(moved.empty() && (Tracked::live == 1));
+    }
+    TEST(Tracked::live == 0);
+
+    {
+        // Move-only elements.
+        ringbuffer::RingBuffer<std::unique_ptr<std::string>, 2> rb;
+        TEST(rb.push(std::make_unique<std::string>("Hello")));
+        TEST(rb.emplace(new std::string("world")) != nullptr);
+        std::unique_ptr<std::string> s;
+        TEST(rb.pop(s) && (*s == "Hello"));
+        TEST(rb.push(std::move(s)) && !s);
+        TEST((*rb.front() == "world") && (*rb.back() == "Hello"));
+    }
+
+    for (int p = 0; p < 5; ++p) {
+        // Iterators and segments follow the elements around the end of the
+        // memory.
+        ringbuffer::RingBuffer<int, 5> rb;
+        for (int i = 0; i < p; ++i) {
+            rb.push(0);
+            rb.pop();
+        }
+        for (int i = 0; i < 5; ++i) {
+            rb.push(4 - i);
+        }
+        std::sort(rb.begin(), rb.end());
+        TEST(std::is_sorted(rb.cbegin(), rb.cend()));
+        TEST((rb.end() - rb.begin()) == 5);
+        TEST(std::accumulate(rb.begin(), rb.end(), 0) == 10);
+        auto it = rb.begin() + 3;
+        TEST((*it == 3) && (it[-1] == 2) && (*(it - 3) == 0));
+        TEST((it > rb.begin()) && (it <= rb.end()) && (it != rb.end()));
+        ringbuffer::RingBuffer<int, 5>::const_iterator cit = it;
+        TEST((*++cit == 4) && (++cit == rb.cend()));
+
+        const ringbuffer::RingBuffer<int, 5> &crb = rb;
+        TEST(Cpp_holds(crb.readSegments(), 0, 5));
+        TEST(crb.readSegments().first.size() == (5 - static_cast<size_t>(p)));
+        TEST(rb.consume(2) == 2);
+        TEST(Cpp_holds(rb.readSegments(), 2, 3));
+
+        auto wseg = rb.writeSegments();
+        TEST((wseg.first.size() + wseg.second.size()) == 2);
+        std::iota(wseg.first.begin(), wseg.first.end(), 5);
+        std::iota(wseg.second.begin(), wseg.second.end(),
+                  5 + static_cast<int>(wseg.first.size()));
+        TEST(rb.commit(3) == 2);
+        TEST(rb.full() && Cpp_holds(rb.readSegments(), 2, 5));
+    }
+
+    {
+        // Power-of-two capacity.
+        ringbuffer::RingBuffer<int, 4> rb;
+        for (int i = 0; i < 100; ++i) {
+            int value;
+            if (rb.full()) {
+                TEST(rb.pop(value) && (value == (i - 4)));
+            }
+            TEST(rb.push(i) && (rb.back() == i));
+        }
+        TEST(Cpp_holds(rb.readSegments(), 96, 4));
+    }
+
+    {
+        int data[5] = {0, 1, 2, 3, 4};
+        ringbuffer::RingBufferRo<int> ro(ringbuffer::Span<const int>(data, 5));
+        int buf[7];
+        TEST(ro.capacity() == 5);
+        ro.read(ringbuffer::Span<int>(buf, 3));
+        TEST((buf[0] == 0) && (buf[2] == 2) && (ro.readPosition() == 3));
+        ro.peek(ringbuffer::Span<int>(buf, 7));
+        TEST((buf[0] == 3) && (buf[2] == 0) && (buf[6] == 4));
+        TEST(Cpp_holds(ro.readSegments(2), 3, 2));
+        TEST(ro.readSegments(4).second.size() == 2);
+        ro.discard(13);
+        TEST(ro.readPosition() == 1);
+        ro.reset();
+        TEST(ro.readPosition() == 0);
+
+        ringbuffer::RingBufferWo<std::string, 3> wo;
+        TEST(wo.capacity() == 3);
+        wo.push("a");
+        wo.push(std::string("b"));
+        TEST((wo.writePosition() == 2) && (wo.data()[1] == "b"));
+        wo.push("c");
+        wo.push("d");
+        auto seg = wo.readSegments();
+        TEST((seg.first.size() == 2) && (seg.first[0] == "b") &&
+             (seg.second[0] == "d"));
+        wo.reset();
+        TEST(wo.writePosition() == 0);
+    }
+
+    std::printf("%s: passed %llu out of %llu\n", __func__,
+                static_cast<unsigned long long>(tests_succeeded),
+                static_cast<unsigned long long>(tests_run));
+
+    return tests_succeeded == tests_run;
+}
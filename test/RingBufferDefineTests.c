@@ -0,0 +1,116 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "RingBufferTests.h"
+#include "RingBufferDefine.h"
+#include "test.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#define POINT_COUNT 5
+#define WORD_COUNT 16
+
+typedef struct {
+    int x;
+    double y;
+} Point;
+
+RINGBUFFER_DEFINE(PointRing, Point, POINT_COUNT)
+RINGBUFFER_DEFINE(WordRing, uint32_t, WORD_COUNT)
+
+bool RingBufferDefine_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    PointRing rb;
+    Point point = {0, 0.0};
+
+    TEST(!PointRing_initialize(NULL));
+    TEST(PointRing_initialize(&rb));
+    TEST(PointRing_getCapacity(NULL) == 0);
+    TEST(PointRing_getCapacity(&rb) == POINT_COUNT);
+    TEST(PointRing_getCount(NULL) == 0);
+    TEST(PointRing_getCount(&rb) == 0);
+    TEST(PointRing_isEmpty(NULL));
+    TEST(PointRing_isEmpty(&rb));
+    TEST(PointRing_isFull(NULL));
+    TEST(!PointRing_isFull(&rb));
+    TEST(!PointRing_push(NULL, point));
+    TEST(!PointRing_pop(NULL, &point));
+    TEST(!PointRing_pop(&rb, &point));
+    TEST(PointRing_peek(NULL) == NULL);
+    TEST(PointRing_peek(&rb) == NULL);
+    TEST(PointRing_at(NULL, 0) == NULL);
+    TEST(PointRing_at(&rb, 0) == NULL);
+
+    int next = 0;
+    int oldest = 0;
+    for (int n = 0; n < 50; ++n) {
+        // Pushes up to three points and pops up to two, so the ring buffer
+        // wraps and fills up.
+        for (int i = 0; i < 3; ++i) {
+            point.x = next;
+            point.y = next / 2.0;
+            bool full = PointRing_isFull(&rb);
+            TEST(PointRing_push(&rb, point) == !full);
+            next += full ? 0 : 1;
+        }
+        size_t count = (size_t)(next - oldest);
+        TEST(PointRing_getCount(&rb) == count);
+        TEST(PointRing_isFull(&rb) == (count == POINT_COUNT));
+        for (size_t i = 0; i < count; ++i) {
+            Point *at = PointRing_at(&rb, i);
+            TEST((at != NULL) && (at->x == (oldest + (int)i)) &&
+                 (at->y == ((oldest + (int)i) / 2.0)));
+        }
+        TEST(PointRing_at(&rb, count) == NULL);
+        TEST(PointRing_peek(&rb) == PointRing_at(&rb, 0));
+        TEST(PointRing_pop(&rb, &point) && (point.x == oldest++));
+        TEST(PointRing_pop(&rb, NULL));
+        ++oldest;
+    }
+    while (PointRing_pop(&rb, &point)) {
+        TEST(point.x == oldest++);
+    }
+    TEST(oldest == next);
+    TEST(PointRing_isEmpty(&rb));
+
+    WordRing words;
+    uint32_t word;
+    TEST(WordRing_initialize(&words));
+    for (uint32_t n = 0; n < 10 * WORD_COUNT; ++n) {
+        // Keeps the power-of-two ring buffer full.
+        if (WordRing_isFull(&words)) {
+            TEST(WordRing_pop(&words, &word) && (word == (n - WORD_COUNT)));
+        }
+        TEST(WordRing_push(&words, n));
+        TEST(*WordRing_at(&words, WordRing_getCount(&words) - 1) == n);
+    }
+    TEST(WordRing_getCount(&words) == WORD_COUNT);
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
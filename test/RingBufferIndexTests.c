@@ -0,0 +1,177 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "RingBufferTests.h"
+#include "RingBufferIndex.h"
+#include "test.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BUFF_SIZE 15
+#define WRITE_STRING "Hello, world!\n"
+#define INDEX_SIZE 5
+
+static void *heapAllocate(void *ctx, size_t size) {
+    (void)ctx;
+    return malloc(size);
+}
+
+static void heapDeallocate(void *ctx, void *data, size_t size) {
+    (void)ctx;
+    (void)size;
+    free(data);
+}
+
+bool RingBufferIndex_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    char buff[BUFF_SIZE];
+    char buff_read[BUFF_SIZE];
+    char buff_writeBytes[BUFF_SIZE];
+    uint64_t offs[INDEX_SIZE];
+    RingBuffer rb;
+    RingBufferIndex ri;
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    size_t pos = 0;
+    size_t len = 0;
+
+    strncpy_s(buff_writeBytes, BUFF_SIZE, WRITE_STRING, strlen(WRITE_STRING));
+
+    RingBuffer_initialize(&rb, buff, BUFF_SIZE);
+    TEST(!RingBufferIndex_initialize(NULL, &rb, offs, INDEX_SIZE));
+    TEST(!RingBufferIndex_initialize(&ri, NULL, offs, INDEX_SIZE));
+    TEST(!RingBufferIndex_initialize(&ri, &rb, NULL, INDEX_SIZE));
+    TEST(!RingBufferIndex_initialize(&ri, &rb, offs, 0));
+    TEST(RingBufferIndex_initialize(&ri, &rb, offs, INDEX_SIZE));
+    TEST(RingBufferIndex_getRecordCapacity(NULL) == 0);
+    TEST(RingBufferIndex_getRecordCapacity(&ri) == INDEX_SIZE);
+    TEST(RingBufferIndex_getRecordCount(NULL) == 0);
+    TEST(RingBufferIndex_getRecordCount(&ri) == 0);
+
+    TEST(!RingBufferIndex_appendRecord(NULL, buff_writeBytes, 1));
+    TEST(!RingBufferIndex_appendRecord(&ri, NULL, 1));
+    TEST(!RingBufferIndex_appendRecord(&ri, buff_writeBytes, BUFF_SIZE + 1));
+    TEST(!RingBufferIndex_seekRecord(NULL, 0, &pos, &len));
+    TEST(!RingBufferIndex_seekRecord(&ri, 0, &pos, &len));
+    TEST(RingBufferIndex_getRecordLength(&ri, 0) == 0);
+    TEST(!RingBufferIndex_peekRecord(&ri, 0, seg));
+    TEST(RingBufferIndex_discardRecords(NULL, 1) == 0);
+    TEST(RingBufferIndex_discardRecords(&ri, 1) == 0);
+
+    // Records of 0 to 4 bytes, then a record that does not fit in the index.
+    for (size_t k = 0; k < INDEX_SIZE; ++k) {
+        TEST(RingBufferIndex_appendRecord(&ri, &buff_writeBytes[k], k));
+    }
+    TEST(!RingBufferIndex_appendRecord(&ri, buff_writeBytes, 0));
+    TEST(RingBufferIndex_getRecordCount(&ri) == INDEX_SIZE);
+    TEST(RingBuffer_getReadByteCapacity(&rb) == 10);
+    TEST(!RingBufferIndex_seekRecord(&ri, 0, NULL, &len));
+    TEST(!RingBufferIndex_seekRecord(&ri, INDEX_SIZE, &pos, &len));
+    TEST(!RingBufferIndex_peekRecord(&ri, 0, NULL));
+    for (size_t k = 0; k < INDEX_SIZE; ++k) {
+        TEST(RingBufferIndex_seekRecord(&ri, k, &pos, NULL));
+        TEST(RingBufferIndex_seekRecord(&ri, k, &pos, &len));
+        TEST((pos == (k * (k - 1) / 2)) && (len == k));
+        TEST(RingBufferIndex_getRecordLength(&ri, k) == k);
+        TEST(RingBufferIndex_peekRecord(&ri, k, seg));
+        TEST((seg[0].len + seg[1].len) == k);
+        TEST(memcmp(seg[0].data, &buff_writeBytes[k], seg[0].len) == 0);
+    }
+
+    // Discarding records keeps the later records' offsets relative to the
+    // read position, across the end of the data memory.
+    TEST(RingBufferIndex_discardRecords(&ri, 0) == 0);
+    TEST(RingBufferIndex_discardRecords(&ri, 4) == 4);
+    TEST(RingBufferIndex_getRecordCount(&ri) == 1);
+    TEST(RingBuffer_getReadByteCapacity(&rb) == 4);
+    TEST(RingBufferIndex_appendRecord(&ri, buff_writeBytes, 7));
+    TEST(RingBufferIndex_appendRecord(&ri, &buff_writeBytes[7], 4));
+    TEST(!RingBufferIndex_appendRecord(&ri, buff_writeBytes, 1));
+    TEST(RingBufferIndex_seekRecord(&ri, 2, &pos, &len));
+    TEST((pos == 11) && (len == 4));
+    TEST(RingBufferIndex_peekRecord(&ri, 1, seg));
+    TEST((seg[0].len == 5) && (seg[1].len == 2));
+    memset(buff_read, 0, BUFF_SIZE);
+    TEST(RingBuffer_peekBytesAt(&rb, pos, buff_read, len) == len);
+    TEST(memcmp(buff_read, &buff_writeBytes[7], len) == 0);
+    TEST(RingBufferIndex_discardRecords(&ri, INDEX_SIZE) == 3);
+    TEST(RingBufferIndex_getRecordCount(&ri) == 0);
+    TEST(RingBuffer_isEmpty(&rb));
+
+    // Bytes before the first record are discarded with it.
+    RingBuffer_writeBytes(&rb, buff_writeBytes, 3);
+    TEST(RingBufferIndex_initialize(&ri, &rb, offs, INDEX_SIZE));
+    TEST(RingBufferIndex_appendRecord(&ri, &buff_writeBytes[3], 2));
+    TEST(RingBufferIndex_seekRecord(&ri, 0, &pos, &len));
+    TEST((pos == 3) && (len == 2));
+    TEST(RingBufferIndex_discardRecords(&ri, 1) == 1);
+    TEST(RingBuffer_isEmpty(&rb));
+
+    for (size_t n = 0; n < 100; ++n) {
+        // Streams records through both rings, discarding the oldest records
+        // to make room.
+        size_t rlen = n % 4;
+        while (!RingBufferIndex_appendRecord(&ri, &buff_writeBytes[n % 8],
+                                             rlen)) {
+            TEST(RingBufferIndex_discardRecords(&ri, 1) == 1);
+        }
+        size_t k = RingBufferIndex_getRecordCount(&ri) - 1;
+        TEST(RingBufferIndex_getRecordLength(&ri, k) == rlen);
+        TEST(RingBufferIndex_seekRecord(&ri, k, &pos, &len));
+        TEST((pos + len) == RingBuffer_getReadByteCapacity(&rb));
+        TEST(RingBuffer_peekBytesAt(&rb, pos, buff_read, len) == len);
+        TEST(memcmp(buff_read, &buff_writeBytes[n % 8], len) == 0);
+    }
+
+    {
+        // Grows a growable companion ring buffer to fit the records, up to
+        // its maximum capacity.
+        RingBufferAllocator alloc = {heapAllocate, heapDeallocate, NULL, 4,
+                                     32};
+        char record[40] = {0};
+        TEST(RingBuffer_initializeGrowable(&rb, &alloc));
+        TEST(RingBufferIndex_initialize(&ri, &rb, offs, INDEX_SIZE));
+        for (size_t k = 0; k < 3; ++k) {
+            TEST(RingBufferIndex_appendRecord(&ri, buff_writeBytes, 10));
+        }
+        TEST(RingBuffer_getByteCapacity(&rb) == 32);
+        TEST(!RingBufferIndex_appendRecord(&ri, buff_writeBytes, 3));
+        TEST(RingBufferIndex_getRecordCount(&ri) == 3);
+        TEST(RingBufferIndex_seekRecord(&ri, 2, &pos, &len));
+        TEST((pos == 20) && (len == 10));
+        TEST(RingBuffer_peekBytesAt(&rb, pos, buff_read, len) == len);
+        TEST(memcmp(buff_read, buff_writeBytes, len) == 0);
+        TEST(RingBufferIndex_discardRecords(&ri, 3) == 3);
+        TEST(!RingBufferIndex_appendRecord(&ri, record, sizeof(record)));
+        TEST(RingBufferIndex_appendRecord(&ri, record, 32));
+        TEST(RingBuffer_freeMemory(&rb));
+    }
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
@@ -0,0 +1,152 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "RingBufferIo.h"
+#include "RingBufferTests.h"
+#include "test.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define BUFF_SIZE 15
+#define WRITE_STRING "Hello, world!\n"
+
+// The test allocator records the largest allocation requested.
+static void *largestAllocate(void *ctx, size_t size) {
+    size_t *largest = (size_t *)ctx;
+    if (size > *largest) {
+        *largest = size;
+    }
+    return malloc(size);
+}
+
+static void largestDeallocate(void *ctx, void *data, size_t size) {
+    (void)ctx;
+    (void)size;
+    free(data);
+}
+
+bool RingBufferIo_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    char buff[BUFF_SIZE];
+    char buff_read[BUFF_SIZE];
+    size_t len = strlen(WRITE_STRING);
+    RingBuffer rb;
+    int fds[2];
+
+    TEST(pipe(fds) == 0);
+    TEST(fcntl(fds[0], F_SETFL, O_NONBLOCK) == 0);
+    RingBuffer_initialize(&rb, buff, BUFF_SIZE);
+
+    errno = 0;
+    TEST(RingBuffer_readFromFd(NULL, fds[0], BUFF_SIZE) == -1);
+    TEST(errno == EINVAL);
+    TEST(RingBuffer_readFromFd(&rb, -1, BUFF_SIZE) == -1);
+    TEST(RingBuffer_readFromFd(&rb, fds[0], 0) == -1);
+    TEST(RingBuffer_writeToFd(NULL, fds[1], BUFF_SIZE) == -1);
+    TEST(RingBuffer_writeToFd(&rb, -1, BUFF_SIZE) == -1);
+    TEST(RingBuffer_writeToFd(&rb, fds[1], 0) == -1);
+
+    errno = 0;
+    TEST(RingBuffer_readFromFd(&rb, fds[0], BUFF_SIZE) == -1);
+    TEST((errno == EAGAIN) || (errno == EWOULDBLOCK));
+    TEST(RingBuffer_isEmpty(&rb));
+    TEST(RingBuffer_writeToFd(&rb, fds[1], BUFF_SIZE) == 0);
+
+    for (size_t p = 0; p < BUFF_SIZE; ++p) {
+        // Leaves one byte at read position p so the free bytes wrap.
+        RingBuffer_reset(&rb);
+        RingBuffer_writeBytes(&rb, WRITE_STRING, p + 1);
+        RingBuffer_discardBytes(&rb, p);
+
+        TEST(write(fds[1], WRITE_STRING, len) == (ssize_t)len);
+        TEST(RingBuffer_readFromFd(&rb, fds[0], BUFF_SIZE) == (ssize_t)len);
+        TEST(RingBuffer_isFull(&rb));
+        errno = 0;
+        TEST(RingBuffer_readFromFd(&rb, fds[0], BUFF_SIZE) == -1);
+        TEST(errno == ENOBUFS);
+
+        TEST(RingBuffer_discardBytes(&rb, 1) == 1);
+        TEST(RingBuffer_getReadBytePosition(&rb) == (p + 1) % BUFF_SIZE);
+        TEST(RingBuffer_writeToFd(&rb, fds[1], 3) == 3);
+        TEST(RingBuffer_writeToFd(&rb, fds[1], BUFF_SIZE) ==
+             (ssize_t)(len - 3));
+        TEST(RingBuffer_isEmpty(&rb));
+
+        memset(buff_read, 0, BUFF_SIZE);
+        TEST(read(fds[0], buff_read, BUFF_SIZE) == (ssize_t)len);
+        TEST(memcmp(buff_read, WRITE_STRING, len) == 0);
+    }
+
+    TEST(close(fds[1]) == 0);
+    TEST(RingBuffer_readFromFd(&rb, fds[0], BUFF_SIZE) == 0);
+    TEST(RingBuffer_isEmpty(&rb));
+    TEST(close(fds[0]) == 0);
+
+    {
+        // Grows a growable ring buffer only when it is full, and by one
+        // doubling, however many bytes the read may take.
+        size_t largest = 0;
+        RingBufferAllocator alloc = {largestAllocate, largestDeallocate,
+                                     &largest, 16, 0};
+        TEST(pipe(fds) == 0);
+        TEST(fcntl(fds[0], F_SETFL, O_NONBLOCK) == 0);
+        TEST(RingBuffer_initializeGrowable(&rb, &alloc));
+
+        TEST(write(fds[1], WRITE_STRING, 5) == 5);
+        TEST(RingBuffer_readFromFd(&rb, fds[0], 1u << 20) == 5);
+        TEST(RingBuffer_readFromFd(&rb, fds[0], SIZE_MAX) == -1);
+        TEST(RingBuffer_getByteCapacity(&rb) == 16);
+        TEST(largest == 16);
+
+        TEST(write(fds[1], WRITE_STRING, len) == (ssize_t)len);
+        TEST(RingBuffer_readFromFd(&rb, fds[0], SIZE_MAX) == 11);
+        TEST(RingBuffer_isFull(&rb));
+        TEST(RingBuffer_readFromFd(&rb, fds[0], SIZE_MAX) ==
+             (ssize_t)(len - 11));
+        TEST(RingBuffer_getByteCapacity(&rb) == 32);
+        TEST(largest == 32);
+        TEST(RingBuffer_readBytes(&rb, buff_read, 5) == 5);
+        TEST(memcmp(buff_read, WRITE_STRING, 5) == 0);
+        TEST(RingBuffer_readBytes(&rb, buff_read, len) == len);
+        TEST(memcmp(buff_read, WRITE_STRING, len) == 0);
+
+        TEST(RingBuffer_freeMemory(&rb));
+        TEST(close(fds[1]) == 0);
+        TEST(close(fds[0]) == 0);
+    }
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
@@ -0,0 +1,102 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "RingBuffer.h"
+#include "RingBufferMirror.h"
+#include "RingBufferTests.h"
+#include "test.h"
+#include <stdio.h>
+#include <string.h>
+
+#define WRITE_STRING "Hello, world!\n"
+
+bool RingBufferMirror_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    size_t page = RingBufferMirror_getPageSize();
+    size_t len = strlen(WRITE_STRING);
+    char buff_read[2 * sizeof(WRITE_STRING)];
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    RingBuffer rb = {0};
+
+    TEST(RingBufferMirror_roundCapacity(0) == 0);
+    TEST(RingBufferMirror_roundCapacity(1) == page);
+    TEST(RingBufferMirror_roundCapacity(page) == page);
+    TEST(RingBufferMirror_roundCapacity(page + 1) == 2 * page);
+    TEST(RingBufferMirror_roundCapacity(SIZE_MAX) == 0);
+
+    TEST(RingBufferMirror_allocate(0) == NULL);
+    TEST(RingBufferMirror_allocate(page + 1) == NULL);
+    TEST(!RingBufferMirror_free(NULL, page));
+
+    uint8_t *data = (uint8_t *)RingBufferMirror_allocate(page);
+    TEST(data != NULL);
+    if (data == NULL) {
+        return false;
+    }
+    data[0] = 'a';
+    data[2 * page - 1] = 'b';
+    TEST((data[page] == 'a') && (data[page - 1] == 'b'));
+
+    TEST(!RingBuffer_initializeMirrored(NULL, data, page));
+    TEST(!RingBuffer_initializeMirrored(&rb, NULL, page));
+    TEST(!RingBuffer_initializeMirrored(&rb, data, 0));
+    TEST(RingBuffer_initializeMirrored(&rb, data, page));
+
+    for (size_t p = page - 2 * len + 1; p <= page - len; ++p) {
+        // Writes across the end of the data memory from read position p.
+        RingBuffer_reset(&rb);
+        TEST(RingBuffer_reserveBytes(&rb, seg, p) == p);
+        TEST(RingBuffer_commitBytes(&rb, p) == p);
+        TEST(RingBuffer_writeBytes(&rb, WRITE_STRING, len) == len);
+        TEST(RingBuffer_discardBytes(&rb, p) == p);
+        TEST(RingBuffer_getReadBytePosition(&rb) == p);
+        TEST(RingBuffer_writeBytes(&rb, WRITE_STRING, len) == len);
+        TEST(RingBuffer_getWriteBytePosition(&rb) == (p + 2 * len - page));
+        TEST(RingBuffer_getReadByteSpan(&rb) == 2 * len);
+        TEST(RingBuffer_getWriteByteSpan(&rb) == page - 2 * len);
+
+        TEST(RingBuffer_peekSegmentsAt(&rb, 1, seg, 2 * len) == 2 * len - 1);
+        TEST((seg[0].data == &data[p + 1]) && (seg[0].len == 2 * len - 1));
+        TEST(seg[1].len == 0);
+        TEST(memcmp(seg[0].data + len - 1, WRITE_STRING, len) == 0);
+
+        memset(buff_read, 0, sizeof(buff_read));
+        TEST(RingBuffer_peekBytesAt(&rb, len, buff_read, len) == len);
+        TEST(memcmp(buff_read, WRITE_STRING, len) == 0);
+        TEST(RingBuffer_readBytes(&rb, buff_read, len + 1) == len + 1);
+        TEST(RingBuffer_getReadBytePosition(&rb) == (p + len + 1) % page);
+        TEST(memcmp(buff_read, WRITE_STRING WRITE_STRING, len + 1) == 0);
+        TEST(RingBuffer_discardBytes(&rb, len) == len - 1);
+        TEST(RingBuffer_isEmpty(&rb));
+    }
+
+    TEST(RingBufferMirror_free(data, page));
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
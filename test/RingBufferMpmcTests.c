@@ -0,0 +1,220 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "RingBufferMpmc.h"
+#include "RingBufferTests.h"
+#include "test.h"
+#include <stdio.h>
+#include <string.h>
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+
+#define ELEM_COUNT 8
+#define THREAD_COUNT 2
+#define TRANSFER_SIZE 20000
+
+typedef struct {
+    uint32_t value;
+    uint8_t tag[3];
+} Mpmc_Element;
+
+#ifndef __STDC_NO_THREADS__
+static atomic_size_t Mpmc_consumed;
+
+typedef struct {
+    RingBufferMpmc *rb;
+    uint32_t id;
+    uint32_t seen[THREAD_COUNT * TRANSFER_SIZE];
+} Mpmc_Thread;
+
+static int Mpmc_produce(void *arg) {
+    Mpmc_Thread *thread = (Mpmc_Thread *)arg;
+    Mpmc_Element batch[3];
+    for (uint32_t n = 0; n < TRANSFER_SIZE;) {
+        // Producer zero enqueues one element at a time and the others batches.
+        size_t count = (thread->id == 0) ? 1 : 3;
+        if (count > (TRANSFER_SIZE - n)) {
+            count = TRANSFER_SIZE - n;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            batch[i].value = thread->id * TRANSFER_SIZE + n + (uint32_t)i;
+        }
+        size_t enqueued = RingBufferMpmc_enqueueBatch(thread->rb, batch, count);
+        if (enqueued == 0) {
+            thrd_yield();
+        }
+        n += (uint32_t)enqueued;
+    }
+    return 0;
+}
+
+static int Mpmc_consume(void *arg) {
+    Mpmc_Thread *thread = (Mpmc_Thread *)arg;
+    Mpmc_Element batch[5];
+    memset(thread->seen, 0, sizeof(thread->seen));
+    while (atomic_load(&Mpmc_consumed) < (THREAD_COUNT * TRANSFER_SIZE)) {
+        // Consumer zero dequeues one element at a time and the others batches.
+        size_t count = (thread->id == 0) ? 1 : 5;
+        size_t dequeued = RingBufferMpmc_dequeueBatch(thread->rb, batch, count);
+        if (dequeued == 0) {
+            thrd_yield();
+        }
+        for (size_t i = 0; i < dequeued; ++i) {
+            ++thread->seen[batch[i].value];
+        }
+        atomic_fetch_add(&Mpmc_consumed, dequeued);
+    }
+    return 0;
+}
+#endif
+
+bool RingBufferMpmc_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    static atomic_size_t buff[ELEM_COUNT * 3];
+    Mpmc_Element elems[ELEM_COUNT + 1];
+    Mpmc_Element elems_read[ELEM_COUNT + 1];
+    RingBufferMpmc rb;
+    size_t slot = RingBufferMpmc_getMemorySize(sizeof(Mpmc_Element), 1);
+
+    memset(elems, 0, sizeof(elems));
+    for (size_t i = 0; i <= ELEM_COUNT; ++i) {
+        elems[i].value = (uint32_t)i;
+        memset(elems[i].tag, (int)i, sizeof(elems[i].tag));
+    }
+
+    TEST(slot >= sizeof(atomic_size_t) + sizeof(Mpmc_Element));
+    TEST(slot <= sizeof(buff) / ELEM_COUNT);
+    TEST(RingBufferMpmc_getMemorySize(0, ELEM_COUNT) == 0);
+    TEST(RingBufferMpmc_getMemorySize(sizeof(Mpmc_Element), 0) == 0);
+    TEST(RingBufferMpmc_getMemorySize(SIZE_MAX, 1) == 0);
+    TEST(RingBufferMpmc_getMemorySize(sizeof(Mpmc_Element), SIZE_MAX) == 0);
+    TEST(RingBufferMpmc_getMemorySize(sizeof(Mpmc_Element), ELEM_COUNT) ==
+         slot * ELEM_COUNT);
+
+    TEST(!RingBufferMpmc_initialize(NULL, buff, sizeof(buff),
+                                    sizeof(Mpmc_Element)));
+    TEST(!RingBufferMpmc_initialize(&rb, NULL, sizeof(buff),
+                                    sizeof(Mpmc_Element)));
+    TEST(!RingBufferMpmc_initialize(&rb, (uint8_t *)buff + 1, slot * 2,
+                                    sizeof(Mpmc_Element)));
+    TEST(!RingBufferMpmc_initialize(&rb, buff, slot * 2 - 1,
+                                    sizeof(Mpmc_Element)));
+    TEST(!RingBufferMpmc_initialize(&rb, buff, sizeof(buff), 0));
+    TEST(RingBufferMpmc_initialize(&rb, buff, slot * 2,
+                                   sizeof(Mpmc_Element)));
+    TEST(RingBufferMpmc_getElementCapacity(&rb) == 2);
+    TEST(RingBufferMpmc_initialize(&rb, buff, slot * ELEM_COUNT - 1,
+                                   sizeof(Mpmc_Element)));
+    TEST(RingBufferMpmc_getElementCapacity(&rb) == ELEM_COUNT / 2);
+    TEST(RingBufferMpmc_initialize(&rb, buff, slot * (ELEM_COUNT + 1),
+                                   sizeof(Mpmc_Element)));
+    TEST(RingBufferMpmc_getDataPointer(&rb) == buff);
+    TEST(RingBufferMpmc_getElementSize(&rb) == sizeof(Mpmc_Element));
+    TEST(RingBufferMpmc_getElementCapacity(&rb) == ELEM_COUNT);
+
+    TEST(RingBufferMpmc_getDataPointer(NULL) == NULL);
+    TEST(RingBufferMpmc_getElementSize(NULL) == 0);
+    TEST(RingBufferMpmc_getElementCapacity(NULL) == 0);
+    TEST(!RingBufferMpmc_enqueue(NULL, &elems[0]));
+    TEST(!RingBufferMpmc_enqueue(&rb, NULL));
+    TEST(RingBufferMpmc_enqueueBatch(NULL, elems, 1) == 0);
+    TEST(RingBufferMpmc_enqueueBatch(&rb, NULL, 1) == 0);
+    TEST(RingBufferMpmc_enqueueBatch(&rb, elems, 0) == 0);
+    TEST(!RingBufferMpmc_dequeue(NULL, &elems_read[0]));
+    TEST(!RingBufferMpmc_dequeue(&rb, NULL));
+    TEST(!RingBufferMpmc_dequeue(&rb, &elems_read[0]));
+    TEST(RingBufferMpmc_dequeueBatch(NULL, elems_read, 1) == 0);
+    TEST(RingBufferMpmc_dequeueBatch(&rb, NULL, 1) == 0);
+    TEST(RingBufferMpmc_dequeueBatch(&rb, elems_read, 0) == 0);
+    TEST(RingBufferMpmc_dequeueBatch(&rb, elems_read, ELEM_COUNT) == 0);
+
+    for (size_t n = 1; n <= ELEM_COUNT; ++n) {
+        for (size_t p = 0; p < ELEM_COUNT; ++p) {
+            // Starts each round at a different index to wrap.
+            RingBufferMpmc_initialize(&rb, buff, sizeof(buff),
+                                      sizeof(Mpmc_Element));
+            for (size_t i = 0; i < p; ++i) {
+                RingBufferMpmc_enqueue(&rb, &elems[0]);
+                RingBufferMpmc_dequeue(&rb, &elems_read[0]);
+            }
+
+            TEST(RingBufferMpmc_enqueueBatch(&rb, elems, n) == n);
+            TEST(RingBufferMpmc_enqueueBatch(&rb, &elems[n], ELEM_COUNT + 1) ==
+                 (ELEM_COUNT - n));
+            TEST(!RingBufferMpmc_enqueue(&rb, &elems[ELEM_COUNT]));
+
+            memset(elems_read, 0, sizeof(elems_read));
+            TEST(RingBufferMpmc_dequeueBatch(&rb, elems_read, n) == n);
+            TEST(memcmp(elems_read, elems, n * sizeof(Mpmc_Element)) == 0);
+            TEST(RingBufferMpmc_enqueue(&rb, &elems[ELEM_COUNT]));
+            TEST(RingBufferMpmc_dequeueBatch(&rb, &elems_read[n],
+                                             ELEM_COUNT + 1) ==
+                 (ELEM_COUNT - n + 1));
+            TEST(memcmp(elems_read, elems,
+                        (ELEM_COUNT + 1) * sizeof(Mpmc_Element)) == 0);
+            TEST(!RingBufferMpmc_dequeue(&rb, &elems_read[0]));
+        }
+    }
+
+#ifndef __STDC_NO_THREADS__
+    {
+        static Mpmc_Thread producers[THREAD_COUNT];
+        static Mpmc_Thread consumers[THREAD_COUNT];
+        thrd_t threads[2 * THREAD_COUNT];
+        atomic_init(&Mpmc_consumed, 0);
+        RingBufferMpmc_initialize(&rb, buff, sizeof(buff),
+                                  sizeof(Mpmc_Element));
+        for (uint32_t i = 0; i < THREAD_COUNT; ++i) {
+            producers[i].rb = &rb;
+            producers[i].id = i;
+            consumers[i].rb = &rb;
+            consumers[i].id = i;
+            TEST(thrd_create(&threads[i], Mpmc_produce, &producers[i]) ==
+                 thrd_success);
+            TEST(thrd_create(&threads[THREAD_COUNT + i], Mpmc_consume,
+                             &consumers[i]) == thrd_success);
+        }
+        for (size_t i = 0; i < 2 * THREAD_COUNT; ++i) {
+            TEST(thrd_join(threads[i], NULL) == thrd_success);
+        }
+        bool once = true;
+        for (size_t v = 0; v < THREAD_COUNT * TRANSFER_SIZE; ++v) {
+            uint32_t seen = 0;
+            for (size_t i = 0; i < THREAD_COUNT; ++i) {
+                seen += consumers[i].seen[v];
+            }
+            once = once && (seen == 1);
+        }
+        TEST(once);
+    }
+#endif
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
@@ -0,0 +1,234 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "RingBufferMpsc.h"
+#include "RingBufferTests.h"
+#include "test.h"
+#include <stdio.h>
+#include <string.h>
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+
+#define BUFF_SIZE 64
+#define WRITE_STRING "Hello, world!\n"
+#define PRODUCER_COUNT 3
+#define RECORD_COUNT 20000
+
+#ifndef __STDC_NO_THREADS__
+typedef struct {
+    RingBufferMpsc *rb;
+    uint8_t id;
+} Mpsc_Producer;
+
+static int Mpsc_produce(void *arg) {
+    Mpsc_Producer *producer = (Mpsc_Producer *)arg;
+    for (uint32_t n = 0; n < RECORD_COUNT;) {
+        // Varies the record length so that records wrap at many offsets.
+        uint8_t record[1 + sizeof(n) + 7];
+        size_t len = 1 + sizeof(n) + (n % 8);
+        memset(record, producer->id, sizeof(record));
+        memcpy(&record[1], &n, sizeof(n));
+        if (RingBufferMpsc_writeBytes(producer->rb, record, len)) {
+            ++n;
+        } else {
+            thrd_yield();
+        }
+    }
+    return 0;
+}
+
+static bool Mpsc_consume(RingBufferMpsc *rb) {
+    uint32_t next[PRODUCER_COUNT] = {0};
+    for (size_t n = 0; n < PRODUCER_COUNT * RECORD_COUNT;) {
+        uint8_t record[16];
+        size_t len;
+        if (!RingBufferMpsc_readRecord(rb, record, sizeof(record), &len)) {
+            if (len != 0) {
+                return false;
+            }
+            thrd_yield();
+            continue;
+        }
+        uint8_t id = record[0];
+        uint32_t seq;
+        memcpy(&seq, &record[1], sizeof(seq));
+        if ((id >= PRODUCER_COUNT) || (seq != next[id]) ||
+            (len != 1 + sizeof(seq) + (seq % 8))) {
+            return false;
+        }
+        for (size_t i = 1 + sizeof(seq); i < len; ++i) {
+            if (record[i] != id) {
+                return false;
+            }
+        }
+        ++next[id];
+        ++n;
+    }
+    return RingBufferMpsc_isEmpty(rb);
+}
+#endif
+
+bool RingBufferMpsc_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    static _Alignas(RINGBUFFERMPSC_HEADER_SIZE) uint8_t buff[BUFF_SIZE];
+    char buff_read[BUFF_SIZE];
+    char buff_writeBytes[BUFF_SIZE];
+    RingBufferMpsc rb;
+    RingBufferMpscClaim claim;
+    RingBufferMpscClaim claim2;
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    size_t len;
+
+    strncpy_s(buff_writeBytes, BUFF_SIZE, WRITE_STRING, strlen(WRITE_STRING));
+
+    TEST(!RingBufferMpsc_initialize(NULL, buff, BUFF_SIZE));
+    TEST(!RingBufferMpsc_initialize(&rb, NULL, BUFF_SIZE));
+    TEST(!RingBufferMpsc_initialize(&rb, buff, 0));
+    TEST(!RingBufferMpsc_initialize(&rb, buff, BUFF_SIZE - 1));
+    TEST(!RingBufferMpsc_initialize(&rb, buff + 1, BUFF_SIZE - 8));
+    TEST(RingBufferMpsc_initialize(&rb, buff, BUFF_SIZE));
+    TEST(RingBufferMpsc_getDataPointer(&rb) == buff);
+    TEST(RingBufferMpsc_getByteCapacity(&rb) == BUFF_SIZE);
+    TEST(RingBufferMpsc_isEmpty(&rb));
+
+    TEST(RingBufferMpsc_getDataPointer(NULL) == NULL);
+    TEST(RingBufferMpsc_getByteCapacity(NULL) == 0);
+    TEST(RingBufferMpsc_isEmpty(NULL));
+    TEST(!RingBufferMpsc_claimBytes(NULL, &claim, 1));
+    TEST(!RingBufferMpsc_claimBytes(&rb, NULL, 1));
+    TEST(!RingBufferMpsc_claimBytes(&rb, &claim, BUFF_SIZE));
+    TEST(!RingBufferMpsc_commitBytes(NULL, &claim));
+    TEST(!RingBufferMpsc_commitBytes(&rb, NULL));
+    TEST(!RingBufferMpsc_abortBytes(NULL, &claim));
+    TEST(!RingBufferMpsc_abortBytes(&rb, NULL));
+    TEST(!RingBufferMpsc_writeBytes(NULL, buff_writeBytes, 1));
+    TEST(!RingBufferMpsc_writeBytes(&rb, NULL, 1));
+    TEST(!RingBufferMpsc_peekRecord(NULL, seg));
+    TEST(!RingBufferMpsc_peekRecord(&rb, NULL));
+    TEST(!RingBufferMpsc_peekRecord(&rb, seg));
+    TEST(!RingBufferMpsc_discardRecord(NULL));
+    TEST(!RingBufferMpsc_discardRecord(&rb));
+    TEST(!RingBufferMpsc_readRecord(NULL, buff_read, BUFF_SIZE, &len));
+    TEST(!RingBufferMpsc_readRecord(&rb, NULL, BUFF_SIZE, &len));
+    TEST(!RingBufferMpsc_readRecord(&rb, buff_read, BUFF_SIZE, NULL));
+    TEST(!RingBufferMpsc_readRecord(&rb, buff_read, BUFF_SIZE, &len));
+    TEST(len == 0);
+    TEST(RingBufferMpsc_isEmpty(&rb));
+
+    TEST(RINGBUFFERMPSC_RECORD_SIZE(0) == 8);
+    TEST(RINGBUFFERMPSC_RECORD_SIZE(1) == 16);
+    TEST(RINGBUFFERMPSC_RECORD_SIZE(8) == 16);
+    TEST(RINGBUFFERMPSC_RECORD_SIZE(9) == 24);
+
+    for (size_t n = 0; n <= (sizeof(WRITE_STRING) - 1); ++n) {
+        for (size_t p = 0; p < BUFF_SIZE; p += RINGBUFFERMPSC_HEADER_SIZE) {
+            // Starts each round at a different write position to wrap.
+            RingBufferMpsc_initialize(&rb, buff, BUFF_SIZE);
+            if (p > 0) {
+                RingBufferMpsc_writeBytes(&rb, buff_writeBytes,
+                                          p - RINGBUFFERMPSC_HEADER_SIZE);
+                RingBufferMpsc_discardRecord(&rb);
+            }
+
+            // Commits records out of claim order.
+            TEST(RingBufferMpsc_claimBytes(&rb, &claim, n));
+            TEST(claim.seg[0].len + claim.seg[1].len == n);
+            TEST(RingBufferMpsc_claimBytes(&rb, &claim2, n));
+            TEST(!RingBufferMpsc_isEmpty(&rb));
+            memcpy(claim2.seg[0].data, buff_writeBytes, claim2.seg[0].len);
+            memcpy(claim2.seg[1].data, &buff_writeBytes[claim2.seg[0].len],
+                   claim2.seg[1].len);
+            TEST(RingBufferMpsc_commitBytes(&rb, &claim2));
+            TEST(!RingBufferMpsc_peekRecord(&rb, seg));
+            memcpy(claim.seg[0].data, buff_writeBytes, claim.seg[0].len);
+            memcpy(claim.seg[1].data, &buff_writeBytes[claim.seg[0].len],
+                   claim.seg[1].len);
+            TEST(RingBufferMpsc_commitBytes(&rb, &claim));
+
+            TEST(RingBufferMpsc_peekRecord(&rb, seg));
+            TEST(seg[0].len + seg[1].len == n);
+            TEST(memcmp(seg[0].data, buff_writeBytes, seg[0].len) == 0);
+            TEST(memcmp(seg[1].data, &buff_writeBytes[seg[0].len],
+                        seg[1].len) == 0);
+            TEST(RingBufferMpsc_discardRecord(&rb));
+
+            memset(buff_read, 0, BUFF_SIZE);
+            if (n > 0) {
+                TEST(!RingBufferMpsc_readRecord(&rb, buff_read, n - 1, &len));
+                TEST(len == n);
+            }
+            TEST(RingBufferMpsc_readRecord(&rb, buff_read, BUFF_SIZE, &len));
+            TEST(len == n);
+            TEST(strncmp(buff_read, buff_writeBytes, n) == 0);
+            TEST(RingBufferMpsc_isEmpty(&rb));
+
+            // Skips aborted records.
+            TEST(RingBufferMpsc_claimBytes(&rb, &claim, n));
+            TEST(RingBufferMpsc_writeBytes(&rb, buff_writeBytes, n));
+            TEST(RingBufferMpsc_abortBytes(&rb, &claim));
+            TEST(RingBufferMpsc_readRecord(&rb, buff_read, BUFF_SIZE, &len));
+            TEST(len == n);
+            TEST(RingBufferMpsc_isEmpty(&rb));
+
+            // Fills the ring buffer.
+            size_t count = 0;
+            while (RingBufferMpsc_writeBytes(&rb, buff_writeBytes, n)) {
+                ++count;
+            }
+            TEST(count == BUFF_SIZE / RINGBUFFERMPSC_RECORD_SIZE(n));
+            TEST(!RingBufferMpsc_claimBytes(&rb, &claim, n));
+            while (RingBufferMpsc_discardRecord(&rb)) {
+                --count;
+            }
+            TEST(count == 0);
+            TEST(RingBufferMpsc_isEmpty(&rb));
+        }
+    }
+
+#ifndef __STDC_NO_THREADS__
+    {
+        thrd_t threads[PRODUCER_COUNT];
+        Mpsc_Producer producers[PRODUCER_COUNT];
+        RingBufferMpsc_initialize(&rb, buff, BUFF_SIZE);
+        for (uint8_t i = 0; i < PRODUCER_COUNT; ++i) {
+            producers[i].rb = &rb;
+            producers[i].id = i;
+            TEST(thrd_create(&threads[i], Mpsc_produce, &producers[i]) ==
+                 thrd_success);
+        }
+        TEST(Mpsc_consume(&rb));
+        for (size_t i = 0; i < PRODUCER_COUNT; ++i) {
+            TEST(thrd_join(threads[i], NULL) == thrd_success);
+        }
+    }
+#endif
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
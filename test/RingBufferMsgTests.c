@@ -0,0 +1,168 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "RingBufferTests.h"
+#include "RingBufferMsg.h"
+#include "test.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BUFF_SIZE 15
+#define WRITE_STRING "Hello, world!\n"
+#define LARGE_SIZE 300
+
+// Returns whether the regions hold the bytes.
+static bool Msg_holds(const RingBufferSegment seg[2], const void *buf,
+                      size_t len) {
+    return ((seg[0].len + seg[1].len) == len) &&
+           (memcmp(seg[0].data, buf, seg[0].len) == 0) &&
+           (memcmp(seg[1].data, (const uint8_t *)buf + seg[0].len,
+                   seg[1].len) == 0);
+}
+
+bool RingBufferMsg_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    char buff[BUFF_SIZE];
+    char buff_read[BUFF_SIZE];
+    char buff_writeBytes[BUFF_SIZE];
+    RingBufferMsg rb;
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+    size_t len;
+
+    strncpy_s(buff_writeBytes, BUFF_SIZE, WRITE_STRING, strlen(WRITE_STRING));
+
+    TEST(!RingBufferMsg_initialize(NULL, buff, BUFF_SIZE));
+    TEST(!RingBufferMsg_initialize(&rb, NULL, BUFF_SIZE));
+    TEST(!RingBufferMsg_initialize(&rb, buff, 0));
+    TEST(RingBufferMsg_initialize(&rb, buff, BUFF_SIZE));
+    TEST(RingBufferMsg_getByteCapacity(NULL) == 0);
+    TEST(RingBufferMsg_getByteCapacity(&rb) == BUFF_SIZE);
+    TEST(RingBufferMsg_isEmpty(NULL));
+    TEST(RingBufferMsg_isEmpty(&rb));
+
+    TEST(RingBufferMsg_getMessageSize(0) == 1);
+    TEST(RingBufferMsg_getMessageSize(127) == 128);
+    TEST(RingBufferMsg_getMessageSize(128) == 130);
+    TEST(RingBufferMsg_getMessageSize(16383) == 16385);
+    TEST(RingBufferMsg_getMessageSize(16384) == 16387);
+    TEST(RingBufferMsg_getMessageSize(SIZE_MAX) ==
+         (SIZE_MAX + RINGBUFFERMSG_MAX_HEADER_SIZE));
+
+    TEST(!RingBufferMsg_fits(NULL, 0));
+    TEST(RingBufferMsg_fits(&rb, BUFF_SIZE - 1));
+    TEST(!RingBufferMsg_fits(&rb, BUFF_SIZE));
+    TEST(!RingBufferMsg_fits(&rb, SIZE_MAX));
+
+    TEST(!RingBufferMsg_pushMessage(NULL, buff_writeBytes, 1));
+    TEST(!RingBufferMsg_pushMessage(&rb, NULL, 1));
+    TEST(!RingBufferMsg_pushMessage(&rb, buff_writeBytes, BUFF_SIZE));
+    TEST(RingBufferMsg_isEmpty(&rb));
+
+    TEST(!RingBufferMsg_peekMessage(NULL, seg));
+    TEST(!RingBufferMsg_peekMessage(&rb, NULL));
+    TEST(!RingBufferMsg_peekMessage(&rb, seg));
+    TEST(!RingBufferMsg_popMessage(NULL));
+    TEST(!RingBufferMsg_popMessage(&rb));
+    len = 1;
+    TEST(!RingBufferMsg_readMessage(NULL, buff_read, BUFF_SIZE, &len));
+    TEST(!RingBufferMsg_readMessage(&rb, NULL, BUFF_SIZE, &len));
+    TEST(!RingBufferMsg_readMessage(&rb, buff_read, BUFF_SIZE, NULL));
+    TEST(!RingBufferMsg_readMessage(&rb, buff_read, BUFF_SIZE, &len));
+    TEST(len == 0);
+
+    // A full-size message, an empty one and a message that does not fit.
+    TEST(RingBufferMsg_pushMessage(&rb, buff_writeBytes, BUFF_SIZE - 2));
+    TEST(RingBufferMsg_pushMessage(&rb, buff_writeBytes, 0));
+    TEST(!RingBufferMsg_fits(&rb, 0));
+    TEST(!RingBufferMsg_pushMessage(&rb, buff_writeBytes, 0));
+    TEST(RingBufferMsg_peekMessage(&rb, seg));
+    TEST(Msg_holds(seg, buff_writeBytes, BUFF_SIZE - 2));
+    TEST(!RingBufferMsg_readMessage(&rb, buff_read, BUFF_SIZE - 3, &len));
+    TEST(len == (BUFF_SIZE - 2));
+    TEST(RingBufferMsg_popMessage(&rb));
+    TEST(RingBufferMsg_peekMessage(&rb, seg));
+    TEST((seg[0].len == 0) && (seg[1].len == 0));
+    TEST(RingBufferMsg_readMessage(&rb, buff_read, 0, &len));
+    TEST(len == 0);
+    TEST(RingBufferMsg_isEmpty(&rb));
+
+    for (size_t n = 0; n < BUFF_SIZE; ++n) {
+        // Pushes and pops messages of every length at every position, behind
+        // one byte that keeps the positions from resetting.
+        for (size_t p = 0; p < BUFF_SIZE; ++p) {
+            RingBufferMsg_initialize(&rb, buff, BUFF_SIZE);
+            RingBuffer_writeBytes(&rb._rb, buff_writeBytes, p + 1);
+            RingBuffer_discardBytes(&rb._rb, p);
+            TEST(RingBufferMsg_fits(&rb, n) == (n < (BUFF_SIZE - 1)));
+            TEST(RingBufferMsg_pushMessage(&rb, buff_writeBytes, n) ==
+                 (n < (BUFF_SIZE - 1)));
+            RingBuffer_discardBytes(&rb._rb, 1);
+            if (n >= (BUFF_SIZE - 1)) {
+                TEST(RingBufferMsg_isEmpty(&rb));
+                continue;
+            }
+            TEST(RingBufferMsg_peekMessage(&rb, seg));
+            TEST(Msg_holds(seg, buff_writeBytes, n));
+            memset(buff_read, 0, BUFF_SIZE);
+            TEST(RingBufferMsg_readMessage(&rb, buff_read, BUFF_SIZE, &len));
+            TEST(len == n);
+            TEST(memcmp(buff_read, buff_writeBytes, n) == 0);
+            TEST(RingBufferMsg_isEmpty(&rb));
+        }
+    }
+
+    {
+        // Messages with two-byte headers, wrapping around the data memory.
+        uint8_t large[2 * LARGE_SIZE];
+        uint8_t large_read[LARGE_SIZE];
+        for (size_t i = 0; i < LARGE_SIZE; ++i) {
+            large_read[i] = (uint8_t)(i * 7);
+        }
+        RingBufferMsg_initialize(&rb, large, sizeof(large));
+        for (size_t n = 100; n <= LARGE_SIZE; n += 50) {
+            TEST(RingBufferMsg_pushMessage(&rb, large_read, n));
+            TEST(RingBufferMsg_pushMessage(&rb, large_read, n / 2));
+            TEST(RingBufferMsg_peekMessage(&rb, seg));
+            TEST(Msg_holds(seg, large_read, n));
+            TEST(RingBufferMsg_popMessage(&rb));
+            TEST(RingBufferMsg_peekMessage(&rb, seg));
+            TEST(Msg_holds(seg, large_read, n / 2));
+            TEST(RingBufferMsg_popMessage(&rb));
+            TEST(RingBufferMsg_isEmpty(&rb));
+        }
+    }
+
+    RingBufferMsg_initialize(&rb, buff, BUFF_SIZE);
+    TEST(RingBufferMsg_pushMessage(&rb, buff_writeBytes, 1));
+    TEST(!RingBufferMsg_reset(NULL));
+    TEST(RingBufferMsg_reset(&rb));
+    TEST(RingBufferMsg_isEmpty(&rb));
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
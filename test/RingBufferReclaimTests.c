@@ -0,0 +1,140 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#define _DEFAULT_SOURCE
+
+#include "RingBufferReclaim.h"
+#include "RingBufferTests.h"
+#include "test.h"
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#ifdef __linux__
+#include "RingBufferMirror.h"
+#endif
+
+#define PAGES 8
+
+// Returns the number of resident pages, or the given number where residency
+// cannot be queried.
+static size_t residentPages(uint8_t *data, size_t page, size_t pages) {
+#ifdef __linux__
+    unsigned char vec[PAGES];
+    size_t count = 0;
+    if (mincore(data, pages * page, vec) != 0) {
+        return pages;
+    }
+    for (size_t i = 0; i < pages; ++i) {
+        count += vec[i] & 1;
+    }
+    return count;
+#else
+    (void)data;
+    (void)page;
+    return pages;
+#endif
+}
+
+static bool isFilled(const uint8_t *buf, size_t len, uint8_t value) {
+    for (size_t i = 0; i < len; ++i) {
+        if (buf[i] != value) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RingBufferReclaim_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    uint8_t *data = (uint8_t *)mmap(NULL, PAGES * page, PROT_READ | PROT_WRITE,
+                                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    TEST(data != MAP_FAILED);
+    if (data == MAP_FAILED) {
+        return false;
+    }
+    uint8_t chunk[256];
+    RingBuffer rb;
+    RingBufferWo wo;
+
+    TEST(RingBufferReclaim_releasePages(NULL, page, false) == 0);
+    TEST(RingBufferReclaim_releasePages(data, 0, false) == 0);
+    TEST(RingBufferReclaim_releasePages(data + 1, page, false) == 0);
+    TEST(RingBufferReclaim_releasePages(data + 1, 2 * page, false) == page);
+
+    // Releases the pages that the reads leave idle, keeping the readable bytes.
+    RingBuffer_initialize(&rb, data, PAGES * page);
+    TEST(RingBuffer_setReclaimer(&rb, RingBufferReclaim_releasePages, page));
+    memset(chunk, 0x5a, sizeof(chunk));
+    while (RingBuffer_writeBytes(&rb, chunk, sizeof(chunk)) > 0) {
+    }
+    TEST(residentPages(data, page, PAGES) == PAGES);
+    TEST(RingBuffer_discardBytes(&rb, 3 * page) == 3 * page);
+    TEST(RingBuffer_reclaimMemory(&rb) == 3 * page);
+    TEST(residentPages(data, page, PAGES) <= PAGES - 3);
+    TEST(RingBuffer_reclaimMemory(&rb) == 3 * page);
+
+    // Releases all pages once the reads drain the ring buffer.
+    size_t left = RingBuffer_getReadByteCapacity(&rb);
+    while (left > 0) {
+        size_t n = RingBuffer_readBytes(&rb, chunk, sizeof(chunk));
+        TEST(isFilled(chunk, n, 0x5a));
+        left -= n;
+    }
+    TEST(residentPages(data, page, PAGES) == 0);
+    TEST(RingBuffer_reclaimMemory(&rb) == 0);
+
+    // Resets the writeBytes-only ring buffer and releases all of its pages.
+    RingBufferWo_initialize(&wo, data, PAGES * page);
+    RingBufferWo_writeBytes(&wo, chunk, sizeof(chunk));
+    TEST(RingBufferWo_resetAndReclaim(NULL) == 0);
+    TEST(RingBufferWo_resetAndReclaim(&wo) == PAGES * page);
+    TEST(RingBufferWo_getWriteBytePosition(&wo) == 0);
+    TEST(residentPages(data, page, PAGES) == 0);
+    TEST(munmap(data, PAGES * page) == 0);
+
+#ifdef __linux__
+    // Frees the shared pages of mirrored data memory in both mappings.
+    data = (uint8_t *)RingBufferMirror_allocate(page);
+    TEST(data != NULL);
+    if (data != NULL) {
+        RingBuffer_initializeMirrored(&rb, data, page);
+        RingBuffer_setReclaimer(&rb, RingBufferReclaim_releasePages, 1);
+        TEST(RingBuffer_writeBytes(&rb, chunk, sizeof(chunk)) ==
+             sizeof(chunk));
+        TEST(data[page] == 0x5a);
+        TEST(RingBuffer_discardBytes(&rb, sizeof(chunk)) == sizeof(chunk));
+        TEST((data[0] == 0) && (data[page] == 0));
+        TEST(RingBufferMirror_free(data, page));
+    }
+#endif
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
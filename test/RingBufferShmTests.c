@@ -0,0 +1,164 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "RingBufferShm.h"
+#include "RingBufferTests.h"
+#include "test.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BUFF_SIZE 15
+#define REGION_SIZE (sizeof(RingBufferShmRegion) + BUFF_SIZE)
+#define WRITE_STRING "Hello, world!\n"
+
+static bool Shm_isEmpty(RingBufferShm *rb, void *data, size_t cap) {
+    return (RingBufferShm_getDataPointer(rb) == data) &&
+           (RingBufferShm_getByteCapacity(rb) == cap) &&
+           (RingBufferShm_getWriteByteCapacity(rb) == cap) &&
+           (RingBufferShm_getReadByteCapacity(rb) == 0) &&
+           RingBufferShm_isEmpty(rb) && !RingBufferShm_isFull(rb);
+}
+
+static bool Shm_isFull(RingBufferShm *rb, void *data, size_t cap) {
+    return (RingBufferShm_getDataPointer(rb) == data) &&
+           (RingBufferShm_getByteCapacity(rb) == cap) &&
+           (RingBufferShm_getWriteByteCapacity(rb) == 0) &&
+           (RingBufferShm_getReadByteCapacity(rb) == cap) &&
+           !RingBufferShm_isEmpty(rb) && RingBufferShm_isFull(rb);
+}
+
+bool RingBufferShm_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    static _Alignas(RingBufferShmRegion) uint8_t region[REGION_SIZE];
+    static _Alignas(RingBufferShmRegion) uint8_t region_copy[REGION_SIZE];
+    RingBufferShmRegion *header = (RingBufferShmRegion *)region;
+    uint8_t *data = region + sizeof(RingBufferShmRegion);
+    char buff_read[BUFF_SIZE];
+    char buff_writeBytes[BUFF_SIZE];
+    RingBufferShm shm;
+    RingBufferShm copy;
+    RingBufferShm *rb = &shm;
+
+    strncpy_s(buff_writeBytes, BUFF_SIZE, WRITE_STRING, strlen(WRITE_STRING));
+
+    TEST(RingBufferShm_getRegionSize(0) == 0);
+    TEST(RingBufferShm_getRegionSize(SIZE_MAX) == 0);
+    TEST(RingBufferShm_getRegionSize(BUFF_SIZE) == REGION_SIZE);
+
+    memset(region, 0, REGION_SIZE);
+    TEST(!RingBufferShm_attach(&copy, region, REGION_SIZE));
+    TEST(!RingBufferShm_initialize(NULL, region, REGION_SIZE));
+    TEST(!RingBufferShm_initialize(rb, NULL, REGION_SIZE));
+    TEST(!RingBufferShm_initialize(rb, region + 1, REGION_SIZE - 1));
+    TEST(!RingBufferShm_initialize(rb, region, sizeof(RingBufferShmRegion)));
+    TEST(RingBufferShm_initialize(rb, region, REGION_SIZE));
+    TEST(Shm_isEmpty(rb, data, BUFF_SIZE));
+
+    TEST(!RingBufferShm_attach(NULL, region, REGION_SIZE));
+    TEST(!RingBufferShm_attach(&copy, NULL, REGION_SIZE));
+    TEST(!RingBufferShm_attach(&copy, region, REGION_SIZE - 1));
+    TEST(RingBufferShm_attach(&copy, region, REGION_SIZE));
+    TEST(Shm_isEmpty(&copy, data, BUFF_SIZE));
+    TEST(RingBufferShm_attach(&copy, region, REGION_SIZE + 1));
+    header->_version = RINGBUFFERSHM_VERSION + 1;
+    TEST(!RingBufferShm_attach(&copy, region, REGION_SIZE));
+    header->_version = RINGBUFFERSHM_VERSION;
+    atomic_store(&header->_wpos, 2 * BUFF_SIZE);
+    TEST(!RingBufferShm_attach(&copy, region, REGION_SIZE));
+    atomic_store(&header->_wpos, 0);
+    TEST(RingBufferShm_attach(&copy, region, REGION_SIZE));
+
+    // The handle keeps the capacity that it validated, whatever another
+    // process writes to the region afterwards.
+    header->_cap = 2 * BUFF_SIZE;
+    header->_offset = 0;
+    TEST(Shm_isEmpty(&copy, data, BUFF_SIZE));
+    TEST(RingBufferShm_writeBytes(&copy, buff_writeBytes, BUFF_SIZE + 1) ==
+         BUFF_SIZE);
+    TEST(Shm_isFull(&copy, data, BUFF_SIZE));
+    TEST(!RingBufferShm_attach(&copy, region, REGION_SIZE));
+
+    TEST(RingBufferShm_getDataPointer(NULL) == NULL);
+    TEST(RingBufferShm_getByteCapacity(NULL) == 0);
+    TEST(RingBufferShm_getWriteByteCapacity(NULL) == 0);
+    TEST(RingBufferShm_getReadByteCapacity(NULL) == 0);
+    TEST(RingBufferShm_isEmpty(NULL));
+    TEST(RingBufferShm_isFull(NULL));
+
+    for (size_t n = 0; n <= BUFF_SIZE; ++n) {
+        for (size_t p = 0; p <= BUFF_SIZE; ++p) {
+            // Starts each round at a different write position to wrap.
+            RingBufferShm_initialize(rb, region, REGION_SIZE);
+            RingBufferShm_writeBytes(rb, buff_writeBytes, p);
+            RingBufferShm_discardBytes(rb, p);
+            TEST(RingBufferShm_writeBytes(NULL, buff_writeBytes, n) == 0);
+            TEST(RingBufferShm_writeBytes(rb, NULL, n) == 0);
+            TEST(RingBufferShm_readBytes(NULL, buff_read, n) == 0);
+            TEST(RingBufferShm_readBytes(rb, NULL, n) == 0);
+            TEST(RingBufferShm_readBytes(rb, buff_read, n) == 0);
+            TEST(RingBufferShm_peekBytes(rb, buff_read, n) == 0);
+            TEST(RingBufferShm_discardBytes(NULL, n) == 0);
+            TEST(Shm_isEmpty(rb, data, BUFF_SIZE));
+
+            TEST(RingBufferShm_writeBytes(rb, buff_writeBytes, n) == n);
+            TEST(RingBufferShm_getWriteByteCapacity(rb) == (BUFF_SIZE - n));
+            TEST(RingBufferShm_getReadByteCapacity(rb) == n);
+            TEST(RingBufferShm_writeBytes(rb, &buff_writeBytes[n],
+                                          BUFF_SIZE) == (BUFF_SIZE - n));
+            TEST(Shm_isFull(rb, data, BUFF_SIZE));
+
+            memset(buff_read, 0, BUFF_SIZE);
+            TEST(RingBufferShm_peekBytesAt(NULL, p, buff_read, n) == 0);
+            TEST(RingBufferShm_peekBytesAt(rb, p, NULL, n) == 0);
+            TEST(RingBufferShm_peekBytesAt(rb, p, buff_read, n) ==
+                 ((n < (BUFF_SIZE - p)) ? n : (BUFF_SIZE - p)));
+            TEST(strncmp(buff_read, &buff_writeBytes[p],
+                         (n < (BUFF_SIZE - p)) ? n : (BUFF_SIZE - p)) == 0);
+
+            // Attaches to a copy of the region at another address, as another
+            // process mapping the same shared memory would.
+            memcpy(region_copy, region, REGION_SIZE);
+            TEST(RingBufferShm_attach(&copy, region_copy, REGION_SIZE));
+            TEST(Shm_isFull(&copy, region_copy + sizeof(RingBufferShmRegion),
+                            BUFF_SIZE));
+
+            memset(buff_read, 0, BUFF_SIZE);
+            TEST(RingBufferShm_readBytes(&copy, buff_read, n) == n);
+            TEST(strncmp(buff_read, buff_writeBytes, n) == 0);
+            TEST(RingBufferShm_discardBytes(rb, n) == n);
+            TEST(RingBufferShm_getWriteByteCapacity(rb) == n);
+            TEST(RingBufferShm_readBytes(rb, buff_read, BUFF_SIZE) ==
+                 (BUFF_SIZE - n));
+            TEST(strncmp(buff_read, &buff_writeBytes[n], BUFF_SIZE - n) == 0);
+            TEST(Shm_isEmpty(rb, data, BUFF_SIZE));
+        }
+    }
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
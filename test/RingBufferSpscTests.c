@@ -0,0 +1,503 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "RingBufferSpsc.h"
+#include "RingBufferTests.h"
+#include "test.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+#ifdef __linux__
+#include <poll.h>
+#endif
+
+#define BUFF_SIZE 15
+#define WRITE_STRING "Hello, world!\n"
+#define TRANSFER_SIZE 100000
+#define TIMEOUT 1000000
+
+// Returns a time in nanoseconds.
+static uint64_t Spsc_now(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static bool Spsc_isEmpty(RingBufferSpsc *rb, void *data, size_t cap) {
+    return (RingBufferSpsc_getDataPointer(rb) == data) &&
+           (RingBufferSpsc_getByteCapacity(rb) == cap) &&
+           (RingBufferSpsc_getWriteByteCapacity(rb) == cap) &&
+           (RingBufferSpsc_getReadByteCapacity(rb) == 0) &&
+           RingBufferSpsc_isEmpty(rb) && !RingBufferSpsc_isFull(rb);
+}
+
+static bool Spsc_isFull(RingBufferSpsc *rb, void *data, size_t cap) {
+    return (RingBufferSpsc_getDataPointer(rb) == data) &&
+           (RingBufferSpsc_getByteCapacity(rb) == cap) &&
+           (RingBufferSpsc_getWriteByteCapacity(rb) == 0) &&
+           (RingBufferSpsc_getReadByteCapacity(rb) == cap) &&
+           !RingBufferSpsc_isEmpty(rb) && RingBufferSpsc_isFull(rb);
+}
+
+#ifndef __STDC_NO_THREADS__
+static int Spsc_produce(void *arg) {
+    RingBufferSpsc *rb = (RingBufferSpsc *)arg;
+    uint8_t value = 0;
+    for (size_t n = 0; n < TRANSFER_SIZE;) {
+        uint8_t chunk[7];
+        size_t len = (TRANSFER_SIZE - n < sizeof(chunk)) ? (TRANSFER_SIZE - n)
+                                                         : sizeof(chunk);
+        for (size_t i = 0; i < len; ++i) {
+            chunk[i] = (uint8_t)(value + i);
+        }
+        // Waits on waitable ring buffers and polls the others.
+        size_t written = RingBufferSpsc_writeBytesWait(
+            rb, chunk, len, RINGBUFFERSPSC_WAIT_FOREVER);
+        if (written == 0) {
+            written = RingBufferSpsc_writeBytes(rb, chunk, len);
+        }
+        if (written == 0) {
+            thrd_yield();
+        }
+        value = (uint8_t)(value + written);
+        n += written;
+    }
+    return 0;
+}
+
+static bool Spsc_consume(RingBufferSpsc *rb) {
+    uint8_t value = 0;
+    for (size_t n = 0; n < TRANSFER_SIZE;) {
+        uint8_t chunk[11];
+        size_t read = RingBufferSpsc_readBytesWait(
+            rb, chunk, sizeof(chunk), RINGBUFFERSPSC_WAIT_FOREVER);
+        if (read == 0) {
+            read = RingBufferSpsc_readBytes(rb, chunk, sizeof(chunk));
+        }
+        if (read == 0) {
+            thrd_yield();
+        }
+        for (size_t i = 0; i < read; ++i) {
+            if (chunk[i] != value++) {
+                return false;
+            }
+        }
+        n += read;
+    }
+    return RingBufferSpsc_isEmpty(rb);
+}
+
+static int Spsc_produceBatch(void *arg) {
+    RingBufferSpscWriteBatch wb;
+    RingBufferSpscWriteBatch_initialize(&wb, (RingBufferSpsc *)arg, 5);
+    uint8_t value = 0;
+    for (size_t n = 0; n < TRANSFER_SIZE;) {
+        size_t written = RingBufferSpscWriteBatch_writeBytes(&wb, &value, 1);
+        if (written == 0) {
+            // Publishes what the consumer may be waiting for.
+            RingBufferSpscWriteBatch_flush(&wb);
+            thrd_yield();
+        }
+        value = (uint8_t)(value + written);
+        n += written;
+    }
+    RingBufferSpscWriteBatch_flush(&wb);
+    return 0;
+}
+
+static bool Spsc_consumeBatch(RingBufferSpsc *rb) {
+    RingBufferSpscReadBatch rd;
+    RingBufferSpscReadBatch_initialize(&rd, rb, 4);
+    uint8_t value = 0;
+    for (size_t n = 0; n < TRANSFER_SIZE;) {
+        uint8_t chunk[3];
+        size_t read = RingBufferSpscReadBatch_readBytes(&rd, chunk,
+                                                        sizeof(chunk));
+        if (read == 0) {
+            RingBufferSpscReadBatch_flush(&rd);
+            thrd_yield();
+        }
+        for (size_t i = 0; i < read; ++i) {
+            if (chunk[i] != value++) {
+                return false;
+            }
+        }
+        n += read;
+    }
+    RingBufferSpscReadBatch_flush(&rd);
+    return RingBufferSpsc_isEmpty(rb);
+}
+
+#ifdef __linux__
+// Waits for the event file descriptor and acknowledges its events.
+static void Spsc_waitEvent(int fd) {
+    struct pollfd pfd = {fd, POLLIN, 0};
+    poll(&pfd, 1, -1);
+    RingBufferSpsc_acknowledgeEvent(fd);
+}
+
+static int Spsc_produceEvent(void *arg) {
+    RingBufferSpsc *rb = (RingBufferSpsc *)arg;
+    uint8_t value = 0;
+    for (size_t n = 0; n < TRANSFER_SIZE;) {
+        uint8_t chunk[7];
+        size_t len = (TRANSFER_SIZE - n < sizeof(chunk)) ? (TRANSFER_SIZE - n)
+                                                         : sizeof(chunk);
+        for (size_t i = 0; i < len; ++i) {
+            chunk[i] = (uint8_t)(value + i);
+        }
+        size_t written = RingBufferSpsc_writeBytes(rb, chunk, len);
+        if (written == 0) {
+            Spsc_waitEvent(RingBufferSpsc_getWriteEventFd(rb));
+        }
+        value = (uint8_t)(value + written);
+        n += written;
+    }
+    return 0;
+}
+
+static bool Spsc_consumeEvent(RingBufferSpsc *rb) {
+    uint8_t value = 0;
+    for (size_t n = 0; n < TRANSFER_SIZE;) {
+        uint8_t chunk[11];
+        size_t read = RingBufferSpsc_readBytes(rb, chunk, sizeof(chunk));
+        if (read == 0) {
+            Spsc_waitEvent(RingBufferSpsc_getReadEventFd(rb));
+        }
+        for (size_t i = 0; i < read; ++i) {
+            if (chunk[i] != value++) {
+                return false;
+            }
+        }
+        n += read;
+    }
+    return RingBufferSpsc_isEmpty(rb);
+}
+#endif
+#endif
+
+bool RingBufferSpsc_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    char buff[BUFF_SIZE];
+    char buff_read[BUFF_SIZE];
+    char buff_writeBytes[BUFF_SIZE];
+    RingBufferSpsc rb;
+
+    strncpy_s(buff_writeBytes, BUFF_SIZE, WRITE_STRING, strlen(WRITE_STRING));
+
+    TEST(!RingBufferSpsc_initialize(NULL, buff, BUFF_SIZE));
+    TEST(!RingBufferSpsc_initialize(&rb, NULL, BUFF_SIZE));
+    TEST(!RingBufferSpsc_initialize(&rb, buff, 0));
+    TEST(!RingBufferSpsc_initialize(&rb, buff, SIZE_MAX));
+    TEST(RingBufferSpsc_initialize(&rb, buff, BUFF_SIZE));
+    TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+
+    TEST(RingBufferSpsc_reset(&rb));
+    TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+
+    TEST(RingBufferSpsc_getDataPointer(NULL) == NULL);
+    TEST(RingBufferSpsc_getByteCapacity(NULL) == 0);
+    TEST(RingBufferSpsc_getWriteByteCapacity(NULL) == 0);
+    TEST(RingBufferSpsc_getReadByteCapacity(NULL) == 0);
+    TEST(RingBufferSpsc_isEmpty(NULL));
+    TEST(RingBufferSpsc_isFull(NULL));
+    TEST(RingBufferSpsc_getWriteByteSpan(NULL) == 0);
+    TEST(RingBufferSpsc_getReadByteSpan(NULL) == 0);
+    TEST(RingBufferSpsc_getWriteByteSpan(&rb) == BUFF_SIZE);
+    TEST(RingBufferSpsc_getReadByteSpan(&rb) == 0);
+    TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+
+    for (size_t n = 0; n <= BUFF_SIZE; ++n) {
+        RingBufferSpsc_initialize(&rb, buff, BUFF_SIZE);
+        TEST(RingBufferSpsc_writeBytes(NULL, buff_writeBytes, n) == 0);
+        TEST(RingBufferSpsc_writeBytes(&rb, NULL, n) == 0);
+        TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+
+        TEST(RingBufferSpsc_writeBytes(&rb, buff_writeBytes, n) == n);
+        TEST(RingBufferSpsc_getWriteByteCapacity(&rb) == (BUFF_SIZE - n));
+        TEST(RingBufferSpsc_getReadByteCapacity(&rb) == n);
+        TEST(RingBufferSpsc_isEmpty(&rb) == (n == 0));
+        TEST(RingBufferSpsc_isFull(&rb) == (n == BUFF_SIZE));
+
+        TEST(RingBufferSpsc_writeBytes(&rb, buff_writeBytes, BUFF_SIZE) ==
+             (BUFF_SIZE - n));
+        TEST(Spsc_isFull(&rb, buff, BUFF_SIZE));
+
+        TEST(RingBufferSpsc_discardBytes(NULL, n) == 0);
+        TEST(RingBufferSpsc_discardBytes(&rb, n) == n);
+        TEST(RingBufferSpsc_getReadByteCapacity(&rb) == (BUFF_SIZE - n));
+        TEST(RingBufferSpsc_discardBytes(&rb, BUFF_SIZE) == (BUFF_SIZE - n));
+        TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+    }
+
+    for (size_t n = 0; n <= BUFF_SIZE; ++n) {
+        for (size_t p = 0; p <= BUFF_SIZE; ++p) {
+            // Starts each round at a different write position to wrap.
+            RingBufferSpsc_initialize(&rb, buff, BUFF_SIZE);
+            RingBufferSpsc_writeBytes(&rb, buff_writeBytes, p);
+            RingBufferSpsc_discardBytes(&rb, p);
+            TEST(RingBufferSpsc_readBytes(NULL, buff_read, n) == 0);
+            TEST(RingBufferSpsc_readBytes(&rb, NULL, n) == 0);
+            TEST(RingBufferSpsc_readBytes(&rb, buff_read, n) == 0);
+            TEST(RingBufferSpsc_peekBytes(&rb, buff_read, n) == 0);
+            TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+
+            TEST(RingBufferSpsc_writeBytes(&rb, buff_writeBytes, BUFF_SIZE) ==
+                 BUFF_SIZE);
+            TEST(RingBufferSpsc_getReadByteSpan(&rb) ==
+                 ((p < BUFF_SIZE) ? (BUFF_SIZE - p) : BUFF_SIZE));
+
+            memset(buff_read, 0, BUFF_SIZE);
+            TEST(RingBufferSpsc_peekBytesAt(NULL, p, buff_read, n) == 0);
+            TEST(RingBufferSpsc_peekBytesAt(&rb, p, NULL, n) == 0);
+            TEST(RingBufferSpsc_peekBytesAt(&rb, p, buff_read, n) ==
+                 ((n < (BUFF_SIZE - p)) ? n : (BUFF_SIZE - p)));
+            TEST(strncmp(buff_read, &buff_writeBytes[p],
+                         (n < (BUFF_SIZE - p)) ? n : (BUFF_SIZE - p)) == 0);
+            TEST(Spsc_isFull(&rb, buff, BUFF_SIZE));
+
+            memset(buff_read, 0, BUFF_SIZE);
+            TEST(RingBufferSpsc_readBytes(&rb, buff_read, n) == n);
+            TEST(strncmp(buff_read, buff_writeBytes, n) == 0);
+            TEST(RingBufferSpsc_getWriteByteCapacity(&rb) == n);
+            TEST(RingBufferSpsc_readBytes(&rb, buff_read, BUFF_SIZE) ==
+                 (BUFF_SIZE - n));
+            TEST(strncmp(buff_read, &buff_writeBytes[n], BUFF_SIZE - n) == 0);
+            TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+        }
+    }
+
+    {
+        RingBufferSpscWriteBatch wb;
+        RingBufferSpscReadBatch rd;
+        TEST(!RingBufferSpscWriteBatch_initialize(NULL, &rb, 0));
+        TEST(!RingBufferSpscWriteBatch_initialize(&wb, NULL, 0));
+        TEST(!RingBufferSpscReadBatch_initialize(NULL, &rb, 0));
+        TEST(!RingBufferSpscReadBatch_initialize(&rd, NULL, 0));
+        TEST(RingBufferSpscWriteBatch_writeBytes(NULL, buff_writeBytes, 1) ==
+             0);
+        TEST(RingBufferSpscWriteBatch_flush(NULL) == 0);
+        TEST(RingBufferSpscReadBatch_readBytes(NULL, buff_read, 1) == 0);
+        TEST(RingBufferSpscReadBatch_discardBytes(NULL, 1) == 0);
+        TEST(RingBufferSpscReadBatch_flush(NULL) == 0);
+
+        for (size_t n = 1; n <= BUFF_SIZE; ++n) {
+            // Starts each round at a different write position to wrap.
+            RingBufferSpsc_initialize(&rb, buff, BUFF_SIZE);
+            RingBufferSpsc_writeBytes(&rb, buff_writeBytes, n);
+            RingBufferSpsc_discardBytes(&rb, n);
+            TEST(RingBufferSpscWriteBatch_initialize(&wb, &rb, 0));
+            TEST(RingBufferSpscReadBatch_initialize(&rd, &rb, 0));
+            TEST(RingBufferSpscWriteBatch_writeBytes(&wb, NULL, 1) == 0);
+            TEST(RingBufferSpscReadBatch_readBytes(&rd, NULL, 1) == 0);
+
+            // Publishes the batched writes only when flushed.
+            for (size_t i = 0; i < n; ++i) {
+                TEST(RingBufferSpscWriteBatch_writeBytes(
+                         &wb, &buff_writeBytes[i], 1) == 1);
+            }
+            TEST(RingBufferSpscWriteBatch_writeBytes(&wb, buff_writeBytes,
+                                                     BUFF_SIZE) ==
+                 BUFF_SIZE - n);
+            TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+            TEST(RingBufferSpscReadBatch_readBytes(&rd, buff_read, 1) == 0);
+            TEST(RingBufferSpscWriteBatch_flush(&wb) == BUFF_SIZE);
+            TEST(RingBufferSpscWriteBatch_flush(&wb) == 0);
+            TEST(Spsc_isFull(&rb, buff, BUFF_SIZE));
+
+            // Releases the batched reads only when flushed.
+            memset(buff_read, 0, BUFF_SIZE);
+            TEST(RingBufferSpscReadBatch_readBytes(&rd, buff_read, n) == n);
+            TEST(strncmp(buff_read, buff_writeBytes, n) == 0);
+            TEST(RingBufferSpscReadBatch_discardBytes(&rd, BUFF_SIZE) ==
+                 BUFF_SIZE - n);
+            TEST(Spsc_isFull(&rb, buff, BUFF_SIZE));
+            TEST(RingBufferSpscReadBatch_flush(&rd) == BUFF_SIZE);
+            TEST(RingBufferSpscReadBatch_flush(&rd) == 0);
+            TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+
+            // Flushes the batches when they reach the threshold.
+            TEST(RingBufferSpscWriteBatch_initialize(&wb, &rb, n));
+            TEST(RingBufferSpscReadBatch_initialize(&rd, &rb, n));
+            for (size_t i = 1; i < n; ++i) {
+                TEST(RingBufferSpscWriteBatch_writeBytes(
+                         &wb, &buff_writeBytes[i], 1) == 1);
+            }
+            TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+            TEST(RingBufferSpscWriteBatch_writeBytes(&wb, buff_writeBytes,
+                                                     1) == 1);
+            TEST(RingBufferSpsc_getReadByteCapacity(&rb) == n);
+            TEST(RingBufferSpscWriteBatch_flush(&wb) == 0);
+            for (size_t i = 1; i < n; ++i) {
+                TEST(RingBufferSpscReadBatch_discardBytes(&rd, 1) == 1);
+            }
+            TEST(RingBufferSpsc_getWriteByteCapacity(&rb) == BUFF_SIZE - n);
+            TEST(RingBufferSpscReadBatch_discardBytes(&rd, 1) == 1);
+            TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+        }
+    }
+
+    TEST(RingBufferSpsc_writeBytesWait(&rb, buff_writeBytes, 1, 0) == 0);
+    TEST(RingBufferSpsc_readBytesWait(&rb, buff_read, 1, 0) == 0);
+    TEST(!RingBufferSpsc_initializeWaitable(NULL, buff, BUFF_SIZE, 0));
+    TEST(!RingBufferSpsc_initializeWaitable(&rb, NULL, BUFF_SIZE, 0));
+    TEST(!RingBufferSpsc_initializeWaitable(&rb, buff, 0, 0));
+    TEST(RingBufferSpsc_initializeWaitable(&rb, buff, BUFF_SIZE, 10));
+    TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+    TEST(RingBufferSpsc_writeBytesWait(NULL, buff_writeBytes, 1, 0) == 0);
+    TEST(RingBufferSpsc_writeBytesWait(&rb, NULL, 1, 0) == 0);
+    TEST(RingBufferSpsc_readBytesWait(NULL, buff_read, 1, 0) == 0);
+    TEST(RingBufferSpsc_readBytesWait(&rb, NULL, 1, 0) == 0);
+    TEST(RingBufferSpsc_readBytesWait(&rb, buff_read, 1, 0) == 0);
+    {
+        uint64_t start = Spsc_now();
+        TEST(RingBufferSpsc_readBytesWait(&rb, buff_read, 1, TIMEOUT) == 0);
+        TEST(Spsc_now() - start >= TIMEOUT);
+    }
+    TEST(RingBufferSpsc_writeBytesWait(&rb, buff_writeBytes, BUFF_SIZE,
+                                       TIMEOUT) == BUFF_SIZE);
+    TEST(Spsc_isFull(&rb, buff, BUFF_SIZE));
+    {
+        uint64_t start = Spsc_now();
+        TEST(RingBufferSpsc_writeBytesWait(&rb, buff_writeBytes, 1, TIMEOUT) ==
+             0);
+        TEST(Spsc_now() - start >= TIMEOUT);
+    }
+    memset(buff_read, 0, BUFF_SIZE);
+    TEST(RingBufferSpsc_readBytesWait(&rb, buff_read, BUFF_SIZE,
+                                      RINGBUFFERSPSC_WAIT_FOREVER) ==
+         BUFF_SIZE);
+    TEST(strncmp(buff_read, buff_writeBytes, BUFF_SIZE) == 0);
+    TEST(Spsc_isEmpty(&rb, buff, BUFF_SIZE));
+
+#ifndef __STDC_NO_THREADS__
+    {
+        // Transfers by polling and in batches.
+        thrd_t producer;
+        RingBufferSpsc_initialize(&rb, buff, BUFF_SIZE);
+        TEST(thrd_create(&producer, Spsc_produce, &rb) == thrd_success);
+        TEST(Spsc_consume(&rb));
+        TEST(thrd_join(producer, NULL) == thrd_success);
+        RingBufferSpsc_initialize(&rb, buff, BUFF_SIZE);
+        TEST(thrd_create(&producer, Spsc_produceBatch, &rb) == thrd_success);
+        TEST(Spsc_consumeBatch(&rb));
+        TEST(thrd_join(producer, NULL) == thrd_success);
+    }
+    for (unsigned spin = 0; spin <= 1000; spin += 1000) {
+        // Transfers by parking at once and by spinning first.
+        thrd_t producer;
+        RingBufferSpsc_initializeWaitable(&rb, buff, BUFF_SIZE, spin);
+        TEST(thrd_create(&producer, Spsc_produce, &rb) == thrd_success);
+        TEST(Spsc_consume(&rb));
+        TEST(thrd_join(producer, NULL) == thrd_success);
+    }
+#endif
+
+#ifdef __linux__
+    {
+        RingBufferSpsc_initialize(&rb, buff, BUFF_SIZE);
+        TEST(RingBufferSpsc_getReadEventFd(NULL) == -1);
+        TEST(RingBufferSpsc_getWriteEventFd(NULL) == -1);
+        TEST(RingBufferSpsc_getReadEventFd(&rb) == -1);
+        TEST(RingBufferSpsc_getWriteEventFd(&rb) == -1);
+        TEST(!RingBufferSpsc_openEventFds(NULL));
+        TEST(!RingBufferSpsc_closeEventFds(NULL));
+        TEST(!RingBufferSpsc_acknowledgeEvent(-1));
+        RingBufferSpsc_writeBytes(&rb, buff_writeBytes, 1);
+        TEST(RingBufferSpsc_openEventFds(&rb));
+        TEST(!RingBufferSpsc_openEventFds(&rb));
+        int rfd = RingBufferSpsc_getReadEventFd(&rb);
+        int wfd = RingBufferSpsc_getWriteEventFd(&rb);
+        TEST((rfd >= 0) && (wfd >= 0) && (rfd != wfd));
+
+        // Signals the bytes already written and the space left when opening.
+        TEST(RingBufferSpsc_acknowledgeEvent(rfd));
+        TEST(!RingBufferSpsc_acknowledgeEvent(rfd));
+        TEST(RingBufferSpsc_acknowledgeEvent(wfd));
+        TEST(!RingBufferSpsc_acknowledgeEvent(wfd));
+        RingBufferSpsc_discardBytes(&rb, 1);
+
+        // Signals only the empty to non-empty edge.
+        TEST(RingBufferSpsc_writeBytes(&rb, buff_writeBytes, 1) == 1);
+        TEST(RingBufferSpsc_writeBytes(&rb, buff_writeBytes, 1) == 1);
+        TEST(RingBufferSpsc_acknowledgeEvent(rfd));
+        TEST(!RingBufferSpsc_acknowledgeEvent(rfd));
+        TEST(RingBufferSpsc_writeBytes(&rb, buff_writeBytes, BUFF_SIZE) ==
+             BUFF_SIZE - 2);
+        TEST(!RingBufferSpsc_acknowledgeEvent(rfd));
+        TEST(!RingBufferSpsc_acknowledgeEvent(wfd));
+
+        // Signals only the full to not full edge.
+        TEST(RingBufferSpsc_readBytes(&rb, buff_read, 1) == 1);
+        TEST(RingBufferSpsc_discardBytes(&rb, 1) == 1);
+        TEST(RingBufferSpsc_acknowledgeEvent(wfd));
+        TEST(!RingBufferSpsc_acknowledgeEvent(wfd));
+        TEST(RingBufferSpsc_writeBytes(&rb, buff_writeBytes, 2) == 2);
+        TEST(!RingBufferSpsc_acknowledgeEvent(rfd));
+        TEST(RingBufferSpsc_discardBytes(&rb, BUFF_SIZE) == BUFF_SIZE);
+        TEST(RingBufferSpsc_acknowledgeEvent(wfd));
+        TEST(!RingBufferSpsc_acknowledgeEvent(rfd));
+
+#ifndef __STDC_NO_THREADS__
+        thrd_t producer;
+        TEST(thrd_create(&producer, Spsc_produceEvent, &rb) == thrd_success);
+        TEST(Spsc_consumeEvent(&rb));
+        TEST(thrd_join(producer, NULL) == thrd_success);
+#endif
+
+        TEST(RingBufferSpsc_closeEventFds(&rb));
+        TEST(RingBufferSpsc_getReadEventFd(&rb) == -1);
+        TEST(RingBufferSpsc_getWriteEventFd(&rb) == -1);
+
+        // Opening on an empty ring buffer makes only the write event file
+        // descriptor readable, and on a full one only the read one.
+        RingBufferSpsc_initialize(&rb, buff, BUFF_SIZE);
+        TEST(RingBufferSpsc_openEventFds(&rb));
+        struct pollfd pfd[2] = {
+            {RingBufferSpsc_getReadEventFd(&rb), POLLIN, 0},
+            {RingBufferSpsc_getWriteEventFd(&rb), POLLIN, 0}};
+        TEST(poll(pfd, 2, 0) == 1);
+        TEST(!(pfd[0].revents & POLLIN) && (pfd[1].revents & POLLIN));
+        TEST(RingBufferSpsc_closeEventFds(&rb));
+        TEST(RingBufferSpsc_writeBytes(&rb, buff_writeBytes, BUFF_SIZE) ==
+             BUFF_SIZE);
+        TEST(RingBufferSpsc_openEventFds(&rb));
+        pfd[0].fd = RingBufferSpsc_getReadEventFd(&rb);
+        pfd[1].fd = RingBufferSpsc_getWriteEventFd(&rb);
+        TEST(poll(pfd, 2, 0) == 1);
+        TEST((pfd[0].revents & POLLIN) && !(pfd[1].revents & POLLIN));
+        TEST(RingBufferSpsc_closeEventFds(&rb));
+    }
+#endif
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
@@ -0,0 +1,181 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "RingBufferTests.h"
+#include "RingBufferStream.h"
+#include "test.h"
+#include <stdio.h>
+#include <string.h>
+
+#define BUFF_SIZE 15
+#define WRITE_STRING "Hello, world!\n"
+#define TRANSFER_SIZE 10000
+
+static bool Stream_isAt(RingBufferStream *rb, uint64_t ack, uint64_t dlv,
+                        uint64_t wr) {
+    size_t cap = RingBufferStream_getByteCapacity(rb);
+    return (RingBufferStream_getAcknowledgeOffset(rb) == ack) &&
+           (RingBufferStream_getDeliverOffset(rb) == dlv) &&
+           (RingBufferStream_getWriteOffset(rb) == wr) &&
+           (RingBufferStream_getDeliverByteCapacity(rb) == (wr - dlv)) &&
+           (RingBufferStream_getWriteByteCapacity(rb) == (cap - (wr - ack)));
+}
+
+// Sends bytes whose values are their stream offsets modulo 256, delivering
+// them in chunks, losing every third chunk and retransmitting from the oldest
+// unacknowledged byte when the ring buffer fills up.
+static bool Stream_transfer(RingBufferStream *rb) {
+    uint64_t wr = 0;
+    uint64_t recv = 0;
+    size_t i = 0;
+    bool success = true;
+    while (recv < TRANSFER_SIZE) {
+        uint8_t chunk[BUFF_SIZE];
+        size_t n = RingBufferStream_getWriteByteCapacity(rb);
+        for (size_t j = 0; j < n; ++j) {
+            chunk[j] = (uint8_t)(wr + j);
+        }
+        wr += RingBufferStream_writeBytes(rb, chunk, n);
+
+        uint64_t off = RingBufferStream_getDeliverOffset(rb);
+        n = RingBufferStream_deliverBytes(rb, chunk, 1 + (i % 7));
+        if ((i++ % 3) != 0) {
+            // The receiver takes the chunk if it is next and acknowledges all
+            // it has received.
+            if (off == recv) {
+                for (size_t j = 0; j < n; ++j) {
+                    success = success && (chunk[j] == (uint8_t)(off + j));
+                }
+                recv += n;
+            }
+            if (recv > RingBufferStream_getAcknowledgeOffset(rb)) {
+                success = success && (RingBufferStream_acknowledge(rb, recv) >
+                                      0);
+            }
+        }
+        if (RingBufferStream_getDeliverByteCapacity(rb) == 0) {
+            success = success &&
+                      RingBufferStream_rewind(
+                          rb, RingBufferStream_getAcknowledgeOffset(rb));
+        }
+        success = success && (RingBufferStream_getWriteOffset(rb) == wr);
+    }
+    return success;
+}
+
+bool RingBufferStream_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    char buff[BUFF_SIZE];
+    char buff_read[BUFF_SIZE];
+    char buff_writeBytes[BUFF_SIZE];
+    RingBufferStream rb;
+    RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+
+    strncpy_s(buff_writeBytes, BUFF_SIZE, WRITE_STRING, strlen(WRITE_STRING));
+
+    TEST(!RingBufferStream_initialize(NULL, buff, BUFF_SIZE));
+    TEST(!RingBufferStream_initialize(&rb, NULL, BUFF_SIZE));
+    TEST(!RingBufferStream_initialize(&rb, buff, 0));
+    TEST(RingBufferStream_initialize(&rb, buff, BUFF_SIZE));
+    TEST(Stream_isAt(&rb, 0, 0, 0));
+    TEST(RingBufferStream_getByteCapacity(NULL) == 0);
+    TEST(RingBufferStream_getByteCapacity(&rb) == BUFF_SIZE);
+    TEST(RingBufferStream_getWriteByteCapacity(NULL) == 0);
+    TEST(RingBufferStream_getDeliverByteCapacity(NULL) == 0);
+    TEST(RingBufferStream_getWriteOffset(NULL) == 0);
+    TEST(RingBufferStream_getDeliverOffset(NULL) == 0);
+    TEST(RingBufferStream_getAcknowledgeOffset(NULL) == 0);
+
+    TEST(RingBufferStream_writeBytes(NULL, buff_writeBytes, 10) == 0);
+    TEST_CHECKED(RingBufferStream_writeBytes(&rb, NULL, 10) == 0);
+    TEST(RingBufferStream_writeBytes(&rb, buff_writeBytes, 10) == 10);
+    TEST(Stream_isAt(&rb, 0, 0, 10));
+
+    TEST(RingBufferStream_deliverBytes(NULL, buff_read, 4) == 0);
+    TEST_CHECKED(RingBufferStream_deliverBytes(&rb, NULL, 4) == 0);
+    memset(buff_read, 0, BUFF_SIZE);
+    TEST(RingBufferStream_deliverBytes(&rb, buff_read, 4) == 4);
+    TEST(strncmp(buff_read, buff_writeBytes, 4) == 0);
+    TEST(Stream_isAt(&rb, 0, 4, 10));
+
+    TEST(RingBufferStream_acknowledge(NULL, 2) == 0);
+    TEST(RingBufferStream_acknowledge(&rb, 5) == 0);
+    TEST(RingBufferStream_acknowledge(&rb, 0) == 0);
+    TEST(RingBufferStream_acknowledge(&rb, 2) == 2);
+    TEST(RingBufferStream_acknowledge(&rb, 2) == 0);
+    TEST(Stream_isAt(&rb, 2, 4, 10));
+
+    // Delivered bytes stay until acknowledged.
+    memset(buff_read, 0, BUFF_SIZE);
+    TEST(RingBufferStream_peekBytesAt(NULL, 2, buff_read, 8) == 0);
+    TEST(RingBufferStream_peekBytesAt(&rb, 1, buff_read, 8) == 0);
+    TEST(RingBufferStream_peekBytesAt(&rb, 10, buff_read, 8) == 0);
+    TEST(RingBufferStream_peekBytesAt(&rb, 2, buff_read, BUFF_SIZE) == 8);
+    TEST(strncmp(buff_read, &buff_writeBytes[2], 8) == 0);
+    TEST(RingBufferStream_peekSegmentsAt(NULL, 3, seg, 2) == 0);
+    TEST(RingBufferStream_peekSegmentsAt(&rb, 1, seg, 2) == 0);
+    TEST(RingBufferStream_peekSegmentsAt(&rb, 3, seg, 2) == 2);
+    TEST((seg[0].data == (uint8_t *)&buff[3]) && (seg[0].len == 2) &&
+         (seg[1].len == 0));
+
+    TEST(!RingBufferStream_rewind(NULL, 2));
+    TEST(!RingBufferStream_rewind(&rb, 1));
+    TEST(!RingBufferStream_rewind(&rb, 11));
+    TEST(RingBufferStream_rewind(&rb, 10));
+    TEST(Stream_isAt(&rb, 2, 10, 10));
+    TEST(RingBufferStream_deliverBytes(&rb, buff_read, 4) == 0);
+    TEST(RingBufferStream_rewind(&rb, 2));
+    TEST(Stream_isAt(&rb, 2, 2, 10));
+    memset(buff_read, 0, BUFF_SIZE);
+    TEST(RingBufferStream_deliverBytes(&rb, buff_read, BUFF_SIZE) == 8);
+    TEST(strncmp(buff_read, &buff_writeBytes[2], 8) == 0);
+    TEST(Stream_isAt(&rb, 2, 10, 10));
+
+    // Offsets keep increasing when the ring buffer empties and wraps.
+    TEST(RingBufferStream_acknowledge(&rb, 10) == 8);
+    TEST(Stream_isAt(&rb, 10, 10, 10));
+    TEST(RingBufferStream_writeBytes(&rb, buff_writeBytes, BUFF_SIZE + 1) ==
+         BUFF_SIZE);
+    TEST(Stream_isAt(&rb, 10, 10, 10 + BUFF_SIZE));
+    TEST(RingBufferStream_writeBytes(&rb, buff_writeBytes, 1) == 0);
+    TEST(RingBufferStream_peekBytesAt(&rb, 10 + BUFF_SIZE - 1, buff_read, 2) ==
+         1);
+    TEST(buff_read[0] == buff_writeBytes[BUFF_SIZE - 1]);
+
+    TEST(RingBufferStream_reset(&rb));
+    TEST(Stream_isAt(&rb, 0, 0, 0));
+    TEST(!RingBufferStream_reset(NULL));
+
+    for (size_t cap = 1; cap <= BUFF_SIZE; ++cap) {
+        RingBufferStream_initialize(&rb, buff, cap);
+        TEST(Stream_transfer(&rb));
+    }
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
@@ -28,6 +28,7 @@ SOFTWARE.
 #include "RingBufferWo.h"
 #include "test.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #define BUFF_SIZE 15
@@ -53,6 +54,48 @@ static bool isFull(RingBuffer *rb, void *data, size_t cap) {
            !RingBuffer_isEmpty(rb) && RingBuffer_isFull(rb);
 }
 
+// Returns whether the bytes count up from seq.
+static bool isSequence(const uint8_t *buf, size_t len, uint8_t seq) {
+    for (size_t i = 0; i < len; ++i) {
+        if (buf[i] != (uint8_t)(seq + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The test allocator counts its live allocations and fails while fail is set.
+typedef struct {
+    size_t live;
+    bool fail;
+} Heap;
+
+static void *heapAllocate(void *ctx, size_t size) {
+    Heap *heap = (Heap *)ctx;
+    void *data = heap->fail ? NULL : malloc(size);
+    if (data != NULL) {
+        ++heap->live;
+    }
+    return data;
+}
+
+static void heapDeallocate(void *ctx, void *data, size_t size) {
+    (void)size;
+    --((Heap *)ctx)->live;
+    free(data);
+}
+
+// The test reclaimer records the last range of data memory that it released.
+static uint8_t *reclaimed_data;
+static size_t reclaimed_len;
+
+static size_t recordReclaim(void *data, size_t len, bool mirrored) {
+    (void)mirrored;
+    reclaimed_data = (uint8_t *)data;
+    reclaimed_len = len;
+    return len;
+}
+
 static bool Ro_isReset(RingBufferRo *rb, void *data, size_t cap) {
     return (RingBufferRo_getDataPointer(rb) == data) &&
            (RingBufferRo_getByteCapacity(rb) == cap) &&
@@ -85,61 +128,69 @@ bool RingBuffer_test(void) {
     TEST(RingBuffer_reset(&rb));
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBuffer_getDataPointer(NULL) == NULL);
+    TEST_CHECKED(RingBuffer_getDataPointer(NULL) == NULL);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
     TEST(RingBuffer_getDataPointer(&rb) == buff);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBuffer_getByteCapacity(NULL) == 0);
+    TEST_CHECKED(RingBuffer_getByteCapacity(NULL) == 0);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
     TEST(RingBuffer_getByteCapacity(&rb) == BUFF_SIZE);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBuffer_getWriteByteCapacity(NULL) == 0);
+    TEST_CHECKED(RingBuffer_getWriteByteCapacity(NULL) == 0);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
     TEST(RingBuffer_getWriteByteCapacity(&rb) == BUFF_SIZE);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
+    TEST(RingBuffer_ensureWriteByteCapacity(&rb, BUFF_SIZE));
+    TEST(!RingBuffer_ensureWriteByteCapacity(&rb, BUFF_SIZE + 1));
+    TEST(isEmpty(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBuffer_getReadByteCapacity(NULL) == 0);
+    TEST_CHECKED(RingBuffer_getReadByteCapacity(NULL) == 0);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
     TEST(RingBuffer_getReadByteCapacity(&rb) == 0);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBuffer_isEmpty(NULL));
+    TEST_CHECKED(RingBuffer_isEmpty(NULL));
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
     TEST(RingBuffer_isEmpty(&rb));
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBuffer_isFull(NULL));
+    TEST_CHECKED(RingBuffer_isFull(NULL));
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
     TEST(!RingBuffer_isFull(&rb));
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBuffer_getWriteBytePosition(NULL) == 0);
+    TEST_CHECKED(RingBuffer_getWriteBytePosition(NULL) == 0);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
     TEST(RingBuffer_getWriteBytePosition(&rb) == 0);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBuffer_getReadBytePosition(NULL) == 0);
+    TEST_CHECKED(RingBuffer_getReadBytePosition(NULL) == 0);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
     TEST(RingBuffer_getReadBytePosition(&rb) == 0);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBuffer_getWriteByteSpan(NULL) == 0);
+    TEST_CHECKED(RingBuffer_getWriteByteSpan(NULL) == 0);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
     TEST(RingBuffer_getWriteByteSpan(&rb) == BUFF_SIZE);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBuffer_getReadByteSpan(NULL) == 0);
+    TEST_CHECKED(RingBuffer_getReadByteSpan(NULL) == 0);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
     TEST(RingBuffer_getReadByteSpan(&rb) == 0);
     TEST(isEmpty(&rb, buff, BUFF_SIZE));
 
+    TEST_CHECKED(!RingBuffer_setStreamingThreshold(NULL, 1));
+    TEST_CHECKED(!RingBuffer_setPrefetchThreshold(NULL, 1));
+    TEST_CHECKED(RingBuffer_linearize(NULL) == 0);
+    TEST_CHECKED(!RingBuffer_setAutoLinearize(NULL, true));
+
     for (size_t n = 0; n <= BUFF_SIZE; ++n) {
         RingBuffer_initialize(&rb, buff, BUFF_SIZE);
-        TEST(RingBuffer_writeBytes(NULL, buff_writeBytes, n) == 0);
+        TEST_CHECKED(RingBuffer_writeBytes(NULL, buff_writeBytes, n) == 0);
         TEST(isEmpty(&rb, buff, BUFF_SIZE));
-        TEST(RingBuffer_writeBytes(&rb, NULL, n) == 0);
+        TEST_CHECKED(RingBuffer_writeBytes(&rb, NULL, n) == 0);
         TEST(isEmpty(&rb, buff, BUFF_SIZE));
 
         TEST(RingBuffer_writeBytes(&rb, buff_writeBytes, n) == n);
@@ -162,7 +213,7 @@ bool RingBuffer_test(void) {
 
     for (size_t n = 0; n <= BUFF_SIZE; ++n) {
         RingBuffer_initialize(&rb, buff, BUFF_SIZE);
-        TEST(RingBuffer_discardBytes(NULL, n) == 0);
+        TEST_CHECKED(RingBuffer_discardBytes(NULL, n) == 0);
         TEST(isEmpty(&rb, buff, BUFF_SIZE));
         TEST(RingBuffer_discardBytes(&rb, n) == 0);
         TEST(isEmpty(&rb, buff, BUFF_SIZE));
@@ -185,9 +236,9 @@ bool RingBuffer_test(void) {
 
     for (size_t n = 0; n <= BUFF_SIZE; ++n) {
         RingBuffer_initialize(&rb, buff, BUFF_SIZE);
-        TEST(RingBuffer_readBytes(NULL, buff_read, n) == 0);
+        TEST_CHECKED(RingBuffer_readBytes(NULL, buff_read, n) == 0);
         TEST(isEmpty(&rb, buff, BUFF_SIZE));
-        TEST(RingBuffer_readBytes(&rb, NULL, n) == 0);
+        TEST_CHECKED(RingBuffer_readBytes(&rb, NULL, n) == 0);
         TEST(isEmpty(&rb, buff, BUFF_SIZE));
         TEST(RingBuffer_readBytes(&rb, buff_read, n) == 0);
         TEST(isEmpty(&rb, buff, BUFF_SIZE));
@@ -213,9 +264,9 @@ bool RingBuffer_test(void) {
 
     for (size_t n = 0; n <= BUFF_SIZE; ++n) {
         RingBuffer_initialize(&rb, buff, BUFF_SIZE);
-        TEST(RingBuffer_peekBytes(NULL, buff_read, n) == 0);
+        TEST_CHECKED(RingBuffer_peekBytes(NULL, buff_read, n) == 0);
         TEST(isEmpty(&rb, buff, BUFF_SIZE));
-        TEST(RingBuffer_peekBytes(&rb, NULL, n) == 0);
+        TEST_CHECKED(RingBuffer_peekBytes(&rb, NULL, n) == 0);
         TEST(isEmpty(&rb, buff, BUFF_SIZE));
         TEST(RingBuffer_peekBytes(&rb, buff_read, n) == 0);
         TEST(isEmpty(&rb, buff, BUFF_SIZE));
@@ -234,9 +285,9 @@ bool RingBuffer_test(void) {
     for (size_t n = 0; n <= BUFF_SIZE; ++n) {
         for (size_t p = 0; p <= BUFF_SIZE; ++p) {
             RingBuffer_initialize(&rb, buff, BUFF_SIZE);
-            TEST(RingBuffer_peekBytesAt(NULL, p, buff_read, n) == 0);
+            TEST_CHECKED(RingBuffer_peekBytesAt(NULL, p, buff_read, n) == 0);
             TEST(isEmpty(&rb, buff, BUFF_SIZE));
-            TEST(RingBuffer_peekBytesAt(&rb, p, NULL, n) == 0);
+            TEST_CHECKED(RingBuffer_peekBytesAt(&rb, p, NULL, n) == 0);
             TEST(isEmpty(&rb, buff, BUFF_SIZE));
             TEST(RingBuffer_peekBytesAt(&rb, p, buff_read, n) == 0);
             TEST(isEmpty(&rb, buff, BUFF_SIZE));
@@ -255,6 +306,358 @@ bool RingBuffer_test(void) {
         }
     }
 
+    for (size_t n = 1; n <= BUFF_SIZE; ++n) {
+        for (size_t p = 0; p < BUFF_SIZE; ++p) {
+            RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+            RingBuffer_initialize(&rb, buff, BUFF_SIZE);
+            RingBuffer_writeBytes(&rb, buff_writeBytes, p);
+            TEST_CHECKED(RingBuffer_reserveBytes(NULL, seg, n) == 0);
+            TEST_CHECKED(RingBuffer_reserveBytes(&rb, NULL, n) == 0);
+            TEST_CHECKED(RingBuffer_commitBytes(NULL, n) == 0);
+            TEST(RingBuffer_reserveBytes(&rb, seg, 0) == 0);
+            TEST_CHECKED(RingBuffer_abortBytes(NULL) == 0);
+
+            // Reading the ring buffer empty keeps the reserved bytes in place.
+            TEST(RingBuffer_reserveBytes(&rb, seg, n) ==
+                 ((n < (BUFF_SIZE - p)) ? n : (BUFF_SIZE - p)));
+            TEST(RingBuffer_readBytes(&rb, buff_read, p) == p);
+            TEST(seg[0].data == (uint8_t *)&buff[p]);
+            TEST(seg[1].data == (uint8_t *)buff);
+            TEST((seg[0].len + seg[1].len) ==
+                 ((n < (BUFF_SIZE - p)) ? n : (BUFF_SIZE - p)));
+            memcpy(seg[0].data, buff_writeBytes, seg[0].len);
+            memcpy(seg[1].data, &buff_writeBytes[seg[0].len], seg[1].len);
+            TEST(RingBuffer_isEmpty(&rb));
+            TEST(RingBuffer_commitBytes(&rb, BUFF_SIZE) ==
+                 (seg[0].len + seg[1].len));
+            TEST(RingBuffer_getReadByteCapacity(&rb) ==
+                 (seg[0].len + seg[1].len));
+            TEST(RingBuffer_commitBytes(&rb, BUFF_SIZE) == 0);
+
+            memset(buff_read, 0, BUFF_SIZE);
+            TEST(RingBuffer_readBytes(&rb, buff_read, BUFF_SIZE) ==
+                 (seg[0].len + seg[1].len));
+            TEST(strncmp(buff_read, buff_writeBytes, seg[0].len + seg[1].len) ==
+                 0);
+            TEST(isEmpty(&rb, buff, BUFF_SIZE));
+
+            TEST(RingBuffer_reserveBytes(&rb, seg, n) == n);
+            TEST(RingBuffer_abortBytes(&rb) == n);
+            TEST(RingBuffer_commitBytes(&rb, n) == 0);
+            TEST(isEmpty(&rb, buff, BUFF_SIZE));
+        }
+    }
+
+    for (size_t n = 0; n <= BUFF_SIZE; ++n) {
+        for (size_t p = 0; p < BUFF_SIZE; ++p) {
+            // Starts at a read position of 5 so that the data wraps.
+            RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+            RingBuffer_initialize(&rb, buff, BUFF_SIZE);
+            TEST(RingBuffer_peekSegmentsAt(&rb, 0, seg, 1) == 0);
+            RingBuffer_writeBytes(&rb, buff_writeBytes, 5);
+            RingBuffer_writeBytes(&rb, buff_writeBytes, BUFF_SIZE - 5);
+            TEST(RingBuffer_discardBytes(&rb, 5) == 5);
+            TEST(RingBuffer_writeBytes(&rb, &buff_writeBytes[BUFF_SIZE - 5],
+                                       BUFF_SIZE) == 5);
+            TEST_CHECKED(RingBuffer_peekSegmentsAt(NULL, p, seg, n) == 0);
+            TEST_CHECKED(RingBuffer_peekSegmentsAt(&rb, p, NULL, n) == 0);
+            TEST(RingBuffer_peekSegmentsAt(&rb, BUFF_SIZE, seg, n) == 0);
+
+            size_t len = (n < (BUFF_SIZE - p)) ? n : (BUFF_SIZE - p);
+            TEST(RingBuffer_peekSegmentsAt(&rb, p, seg, n) == len);
+            if (len > 0) {
+                TEST((seg[0].len + seg[1].len) == len);
+                size_t off = (5 + p) % BUFF_SIZE;
+                TEST(seg[0].data == (uint8_t *)&buff[off]);
+                TEST(seg[1].len ==
+                     (((off + len) > BUFF_SIZE) ? (off + len - BUFF_SIZE) : 0));
+                TEST(memcmp(seg[0].data, &buff_writeBytes[p], seg[0].len) ==
+                     0);
+                TEST(memcmp(seg[1].data, &buff_writeBytes[p + seg[0].len],
+                            seg[1].len) == 0);
+            }
+            TEST(isFull(&rb, buff, BUFF_SIZE));
+
+            TEST(RingBuffer_peekSegments(&rb, seg, n) == n);
+            TEST(RingBuffer_consumeBytes(&rb, n) == n);
+            TEST(RingBuffer_getReadByteCapacity(&rb) == (BUFF_SIZE - n));
+            TEST(RingBuffer_getReadBytePosition(&rb) ==
+                 ((n < BUFF_SIZE) ? ((5 + n) % BUFF_SIZE) : 0));
+            memset(buff_read, 0, BUFF_SIZE);
+            TEST(RingBuffer_readBytes(&rb, buff_read, BUFF_SIZE) ==
+                 (BUFF_SIZE - n));
+            TEST(strncmp(buff_read, &buff_writeBytes[n], BUFF_SIZE - n) == 0);
+            TEST(isEmpty(&rb, buff, BUFF_SIZE));
+        }
+    }
+
+    for (size_t cap = 1; cap <= (2 * BUFF_SIZE); ++cap) {
+        // Streams bytes through power-of-two and other capacities.
+        uint8_t data[2 * BUFF_SIZE];
+        uint8_t chunk[2 * BUFF_SIZE + 1];
+        uint8_t wseq = 0;
+        uint8_t rseq = 0;
+        size_t len = 0;
+        RingBuffer_initialize(&rb, data, cap);
+        for (size_t i = 0; i < 100; ++i) {
+            size_t n = (i * 7) % (cap + 2);
+            for (size_t j = 0; j < n; ++j) {
+                chunk[j] = (uint8_t)(wseq + j);
+            }
+            size_t wlen = (n < (cap - len)) ? n : (cap - len);
+            TEST(RingBuffer_writeBytes(&rb, chunk, n) == wlen);
+            wseq = (uint8_t)(wseq + wlen);
+            len += wlen;
+            TEST(RingBuffer_getWriteBytePosition(&rb) < cap);
+
+            size_t p = i % (len + 1);
+            if (p < len) {
+                TEST(RingBuffer_peekBytesAt(&rb, p, chunk, cap) == (len - p));
+                TEST(isSequence(chunk, len - p, (uint8_t)(rseq + p)));
+            }
+
+            n = (i * 5) % (cap + 2);
+            size_t rlen = (n < len) ? n : len;
+            if ((i % 3) == 0) {
+                TEST(RingBuffer_discardBytes(&rb, n) == ((n > 0) ? rlen : 0));
+            } else {
+                TEST(RingBuffer_readBytes(&rb, chunk, n) ==
+                     ((n > 0) ? rlen : 0));
+                TEST(isSequence(chunk, (n > 0) ? rlen : 0, rseq));
+            }
+            if (n > 0) {
+                rseq = (uint8_t)(rseq + rlen);
+                len -= rlen;
+            }
+            TEST(RingBuffer_getReadByteCapacity(&rb) == len);
+            TEST(RingBuffer_getReadBytePosition(&rb) < cap);
+        }
+    }
+
+    for (size_t k = 0; k < 4; ++k) {
+        // Copies every length through the short, vector and memcpy() paths,
+        // then with non-temporal stores and prefetching from 64 bytes on.
+        size_t cap = ((k % 2) == 0) ? 1000 : 1024;
+        size_t threshold = (k < 2) ? 0 : 64;
+        uint8_t data[1024];
+        uint8_t chunk[700] = {0};
+        uint8_t seq = 0;
+        RingBuffer_initialize(&rb, data, cap);
+        TEST(RingBuffer_setStreamingThreshold(&rb, threshold));
+        TEST(RingBuffer_setPrefetchThreshold(&rb, threshold));
+        TEST(RingBuffer_writeBytes(&rb, chunk, 1) == 1);
+        for (size_t n = 1; n <= sizeof(chunk); ++n) {
+            // The byte left from the last pass keeps the positions moving.
+            for (size_t j = 0; j < n; ++j) {
+                chunk[j] = (uint8_t)(seq + j);
+            }
+            TEST(RingBuffer_writeBytes(&rb, chunk, n) == n);
+            memset(chunk, 0, n);
+            TEST(RingBuffer_peekBytesAt(&rb, 1, chunk, n) == n);
+            TEST(isSequence(chunk, n, seq));
+            TEST(RingBuffer_discardBytes(&rb, 1) == 1);
+            memset(chunk, 0, n);
+            TEST(RingBuffer_readBytes(&rb, chunk, n - 1) == (n - 1));
+            TEST(isSequence(chunk, n - 1, seq));
+            seq = (uint8_t)(seq + n);
+        }
+    }
+
+    for (size_t cap = 1; cap <= 700; cap += (cap < (2 * BUFF_SIZE)) ? 1 : 67) {
+        // Linearizes every read position and length, wrapped or not, with
+        // blocks smaller and larger than the scratch area.
+        uint8_t data[700];
+        uint8_t chunk[700];
+        size_t step = (cap < (2 * BUFF_SIZE)) ? 1 : 29;
+        for (size_t i = 0; i < sizeof(chunk); ++i) {
+            chunk[i] = (uint8_t)i;
+        }
+        for (size_t rpos = 0; rpos < cap; rpos += step) {
+            for (size_t len = 0; len <= cap; len += step) {
+                size_t first = (len < (cap - rpos)) ? len : (cap - rpos);
+                RingBuffer_initialize(&rb, data, cap);
+                RingBuffer_writeBytes(&rb, chunk, rpos);
+                RingBuffer_writeBytes(&rb, chunk, first);
+                RingBuffer_discardBytes(&rb, rpos);
+                RingBuffer_writeBytes(&rb, &chunk[first], len - first);
+                TEST(RingBuffer_getReadByteCapacity(&rb) == len);
+
+                TEST(RingBuffer_linearize(&rb) == len);
+                TEST(RingBuffer_getReadBytePosition(&rb) == 0);
+                TEST(RingBuffer_getWriteBytePosition(&rb) ==
+                     ((len < cap) ? len : 0));
+                TEST(RingBuffer_getReadByteSpan(&rb) == len);
+                TEST(isSequence(data, len, 0));
+
+                RingBuffer_writeBytes(&rb, &chunk[len], cap - len);
+                TEST(RingBuffer_readBytes(&rb, data, cap) == cap);
+                TEST(isSequence(data, cap, 0));
+            }
+        }
+    }
+
+    {
+        // Linearizes automatically before writes and reservations that wrap.
+        uint8_t data[2 * BUFF_SIZE];
+        uint8_t chunk[2 * BUFF_SIZE];
+        uint8_t wseq = 0;
+        uint8_t rseq = 0;
+        RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+        RingBuffer_initialize(&rb, data, sizeof(data));
+        TEST(RingBuffer_setAutoLinearize(&rb, true));
+        for (size_t i = 0; i < 200; ++i) {
+            size_t n = (i * 7) % sizeof(chunk);
+            for (size_t j = 0; j < n; ++j) {
+                chunk[j] = (uint8_t)(wseq + j);
+            }
+            if ((i % 2) == 0) {
+                n = RingBuffer_writeBytes(&rb, chunk, n);
+            } else {
+                n = RingBuffer_reserveBytes(&rb, seg, n);
+                TEST(seg[1].len == 0);
+                memcpy(seg[0].data, chunk, seg[0].len);
+                RingBuffer_commitBytes(&rb, n);
+            }
+            wseq = (uint8_t)(wseq + n);
+            TEST(RingBuffer_getReadByteSpan(&rb) ==
+                 RingBuffer_getReadByteCapacity(&rb));
+
+            n = RingBuffer_readBytes(&rb, chunk, (i * 5) % sizeof(chunk));
+            TEST(isSequence(chunk, n, rseq));
+            rseq = (uint8_t)(rseq + n);
+        }
+
+        TEST(RingBuffer_writeBytes(&rb, chunk, 1) == 1);
+        TEST(RingBuffer_reserveBytes(&rb, seg, 1) == 1);
+        TEST(RingBuffer_linearize(&rb) == 0);
+        TEST(RingBuffer_abortBytes(&rb) == 1);
+        TEST(RingBuffer_setAutoLinearize(&rb, false));
+    }
+
+    {
+        // Grows a ring buffer on demand and shrinks it back when idle.
+        Heap heap = {0, false};
+        RingBufferAllocator alloc = {heapAllocate, heapDeallocate, &heap, 16,
+                                     256};
+        RingBufferAllocator bad = alloc;
+        RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+        uint8_t chunk[300];
+        uint8_t chunk_read[300];
+        for (size_t i = 0; i < sizeof(chunk); ++i) {
+            chunk[i] = (uint8_t)i;
+        }
+        TEST(!RingBuffer_initializeGrowable(NULL, &alloc));
+        TEST(!RingBuffer_initializeGrowable(&rb, NULL));
+        bad.minCap = 0;
+        TEST(!RingBuffer_initializeGrowable(&rb, &bad));
+        bad.minCap = 512;
+        TEST(!RingBuffer_initializeGrowable(&rb, &bad));
+        heap.fail = true;
+        TEST(!RingBuffer_initializeGrowable(&rb, &alloc));
+        heap.fail = false;
+        TEST_CHECKED(!RingBuffer_freeMemory(NULL));
+        TEST(!RingBuffer_freeMemory(&rb));
+
+        TEST(RingBuffer_initializeGrowable(&rb, &alloc));
+        TEST(heap.live == 1);
+        TEST(RingBuffer_getByteCapacity(&rb) == 16);
+        heap.fail = true;
+        TEST(RingBuffer_writeBytes(&rb, chunk, 20) == 16);
+        TEST(RingBuffer_getByteCapacity(&rb) == 16);
+        heap.fail = false;
+        TEST(RingBuffer_discardBytes(&rb, 16) == 16);
+
+        TEST(RingBuffer_writeBytes(&rb, chunk, 10) == 10);
+        TEST(RingBuffer_discardBytes(&rb, 8) == 8);
+        TEST(RingBuffer_writeBytes(&rb, &chunk[10], 12) == 12);
+        TEST(RingBuffer_writeBytes(&rb, &chunk[22], 100) == 100);
+        TEST(RingBuffer_getByteCapacity(&rb) == 128);
+        TEST(RingBuffer_getReadBytePosition(&rb) == 0);
+        TEST(heap.live == 1);
+        TEST(RingBuffer_writeBytes(&rb, &chunk[122], 178) == 142);
+        TEST(RingBuffer_getByteCapacity(&rb) == 256);
+        TEST(RingBuffer_isFull(&rb));
+        TEST(RingBuffer_readBytes(&rb, chunk_read, sizeof(chunk_read)) ==
+             256);
+        TEST(isSequence(chunk_read, 256, 8));
+
+        for (size_t i = 1; i <= 40; ++i) {
+            TEST(RingBuffer_writeBytes(&rb, chunk, 4) == 4);
+            TEST(RingBuffer_readBytes(&rb, chunk_read, 4) == 4);
+            TEST(RingBuffer_getByteCapacity(&rb) ==
+                 ((i < 32) ? (256u >> (i / 8)) : 16));
+        }
+        TEST(heap.live == 1);
+
+        // A reservation, whose length is only an upper bound, doubles the
+        // capacity at most once.
+        TEST(RingBuffer_reserveBytes(&rb, seg, 40) == 32);
+        TEST(RingBuffer_getByteCapacity(&rb) == 32);
+        TEST(seg[0].len == 32);
+        memcpy(seg[0].data, chunk, seg[0].len);
+        TEST(RingBuffer_commitBytes(&rb, 32) == 32);
+        TEST(RingBuffer_peekBytes(&rb, chunk_read, 32) == 32);
+        TEST(isSequence(chunk_read, 32, 0));
+        TEST(RingBuffer_reserveBytes(&rb, seg, SIZE_MAX) == 32);
+        TEST(RingBuffer_getByteCapacity(&rb) == 64);
+        TEST(RingBuffer_abortBytes(&rb) == 32);
+
+        TEST_CHECKED(!RingBuffer_ensureWriteByteCapacity(NULL, 1));
+        TEST(RingBuffer_ensureWriteByteCapacity(&rb, 200));
+        TEST(RingBuffer_getByteCapacity(&rb) == 256);
+        TEST(!RingBuffer_ensureWriteByteCapacity(&rb, 300));
+        TEST(RingBuffer_getByteCapacity(&rb) == 256);
+        TEST(RingBuffer_peekBytes(&rb, chunk_read, 32) == 32);
+        TEST(isSequence(chunk_read, 32, 0));
+
+        TEST(RingBuffer_freeMemory(&rb));
+        TEST(heap.live == 0);
+        TEST(!RingBuffer_freeMemory(&rb));
+    }
+
+    {
+        // Releases the idle data memory short of the cold data memory.
+        uint8_t data[32];
+        uint8_t chunk[32] = {0};
+        RingBufferSegment seg[2] = {{NULL, 0}, {NULL, 0}};
+        RingBuffer_initialize(&rb, data, sizeof(data));
+        TEST_CHECKED(!RingBuffer_setReclaimer(NULL, recordReclaim, 0));
+        TEST_CHECKED(RingBuffer_reclaimMemory(NULL) == 0);
+        TEST(RingBuffer_reclaimMemory(&rb) == 0);
+
+        TEST(RingBuffer_setReclaimer(&rb, recordReclaim, 0));
+        TEST(RingBuffer_reclaimMemory(&rb) == 32);
+        TEST((reclaimed_data == data) && (reclaimed_len == 32));
+        reclaimed_data = NULL;
+        TEST(RingBuffer_reclaimMemory(&rb) == 0);
+        TEST(reclaimed_data == NULL);
+
+        RingBuffer_writeBytes(&rb, chunk, 10);
+        RingBuffer_discardBytes(&rb, 4);
+        TEST(RingBuffer_reclaimMemory(&rb) == 4);
+        TEST((reclaimed_data == data) && (reclaimed_len == 4));
+        RingBuffer_writeBytes(&rb, chunk, 20);
+        TEST(RingBuffer_reserveBytes(&rb, seg, 4) == 4);
+        TEST(RingBuffer_reclaimMemory(&rb) == 2);
+        TEST((reclaimed_data == &data[2]) && (reclaimed_len == 2));
+        RingBuffer_abortBytes(&rb);
+        TEST(RingBuffer_reclaimMemory(&rb) == 6);
+        TEST((reclaimed_data == &data[0]) && (reclaimed_len == 4));
+
+        TEST(RingBuffer_setReclaimer(&rb, recordReclaim, 16));
+        reclaimed_data = NULL;
+        TEST(RingBuffer_discardBytes(&rb, 20) == 20);
+        TEST(reclaimed_data == NULL);
+        TEST(RingBuffer_discardBytes(&rb, 6) == 6);
+        TEST((reclaimed_data == data) && (reclaimed_len == 32));
+        reclaimed_data = NULL;
+        RingBuffer_writeBytes(&rb, chunk, 8);
+        RingBuffer_readBytes(&rb, chunk, 8);
+        TEST(reclaimed_data == NULL);
+        TEST(RingBuffer_setReclaimer(&rb, NULL, 0));
+        TEST(RingBuffer_reclaimMemory(&rb) == 0);
+    }
+
     printf("%s: passed %llu out of %llu\n", __func__, tests_succeeded,
            tests_run);
 
@@ -280,17 +683,17 @@ bool RingBufferRo_test(void) {
     TEST(RingBufferRo_reset(&rb));
     TEST(Ro_isReset(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBufferRo_getDataPointer(NULL) == NULL);
+    TEST_CHECKED(RingBufferRo_getDataPointer(NULL) == NULL);
     TEST(Ro_isReset(&rb, buff, BUFF_SIZE));
     TEST(RingBufferRo_getDataPointer(&rb) == buff);
     TEST(Ro_isReset(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBufferRo_getByteCapacity(NULL) == 0);
+    TEST_CHECKED(RingBufferRo_getByteCapacity(NULL) == 0);
     TEST(Ro_isReset(&rb, buff, BUFF_SIZE));
     TEST(RingBufferRo_getByteCapacity(&rb) == BUFF_SIZE);
     TEST(Ro_isReset(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBufferRo_getReadBytePosition(NULL) == 0);
+    TEST_CHECKED(RingBufferRo_getReadBytePosition(NULL) == 0);
     TEST(Ro_isReset(&rb, buff, BUFF_SIZE));
     TEST(RingBufferRo_getReadBytePosition(&rb) == 0);
     TEST(Ro_isReset(&rb, buff, BUFF_SIZE));
@@ -337,6 +740,48 @@ bool RingBufferRo_test(void) {
         }
     }
 
+    uint8_t data[BUFF_SIZE + 1];
+    uint8_t chunk[3 * (BUFF_SIZE + 1)];
+    for (size_t i = 0; i < sizeof(data); ++i) {
+        data[i] = (uint8_t)i;
+    }
+    for (size_t cap = 1; cap <= sizeof(data); ++cap) {
+        // Wraps the read position by mask, subtraction and reciprocal.
+        RingBufferRo_initialize(&rb, data, cap);
+        size_t rpos = 0;
+        for (size_t n = 1; n <= (3 * cap); ++n) {
+            TEST(RingBufferRo_peekBytesAt(&rb, 1000 * n, chunk, 1) == 1);
+            TEST(chunk[0] == ((rpos + 1000 * n) % cap));
+            TEST(RingBufferRo_readBytes(&rb, chunk, n) == n);
+            for (size_t i = 0; i < n; ++i) {
+                TEST(chunk[i] == ((rpos + i) % cap));
+            }
+            rpos = (rpos + n) % cap;
+            TEST(RingBufferRo_getReadBytePosition(&rb) == rpos);
+            TEST(RingBufferRo_discardBytes(&rb, 65537 * n) == (65537 * n));
+            rpos = (rpos + 65537 * n) % cap;
+            TEST(RingBufferRo_getReadBytePosition(&rb) == rpos);
+        }
+    }
+
+    uint8_t large[1000];
+    uint8_t large_read[700];
+    for (size_t i = 0; i < sizeof(large); ++i) {
+        large[i] = (uint8_t)(i % 251);
+    }
+    RingBufferRo_initialize(&rb, large, sizeof(large));
+    size_t lpos = 0;
+    for (size_t n = 1; n <= sizeof(large_read); ++n) {
+        // Copies every length through the short, vector and memcpy() paths.
+        TEST(RingBufferRo_readBytes(&rb, large_read, n) == n);
+        bool same = true;
+        for (size_t i = 0; i < n; ++i) {
+            same = same && (large_read[i] == large[(lpos + i) % sizeof(large)]);
+        }
+        TEST(same);
+        lpos = (lpos + n) % sizeof(large);
+    }
+
     printf("%s: passed %llu out of %llu\n", __func__, tests_succeeded,
            tests_run);
 
@@ -362,26 +807,26 @@ bool RingBufferWo_test(void) {
     TEST(RingBufferWo_reset(&rb));
     TEST(Wo_isReset(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBufferWo_getDataPointer(NULL) == NULL);
+    TEST_CHECKED(RingBufferWo_getDataPointer(NULL) == NULL);
     TEST(Wo_isReset(&rb, buff, BUFF_SIZE));
     TEST(RingBufferWo_getDataPointer(&rb) == buff);
     TEST(Wo_isReset(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBufferWo_getByteCapacity(NULL) == 0);
+    TEST_CHECKED(RingBufferWo_getByteCapacity(NULL) == 0);
     TEST(Wo_isReset(&rb, buff, BUFF_SIZE));
     TEST(RingBufferWo_getByteCapacity(&rb) == BUFF_SIZE);
     TEST(Wo_isReset(&rb, buff, BUFF_SIZE));
 
-    TEST(RingBufferWo_getWriteBytePosition(NULL) == 0);
+    TEST_CHECKED(RingBufferWo_getWriteBytePosition(NULL) == 0);
     TEST(Wo_isReset(&rb, buff, BUFF_SIZE));
     TEST(RingBufferWo_getWriteBytePosition(&rb) == 0);
     TEST(Wo_isReset(&rb, buff, BUFF_SIZE));
 
     for (size_t n = 0; n <= BUFF_SIZE; ++n) {
         RingBufferWo_initialize(&rb, buff, BUFF_SIZE);
-        TEST(RingBufferWo_writeBytes(NULL, buff_writeBytes, n) == 0);
+        TEST_CHECKED(RingBufferWo_writeBytes(NULL, buff_writeBytes, n) == 0);
         TEST(Wo_isReset(&rb, buff, BUFF_SIZE));
-        TEST(RingBufferWo_writeBytes(&rb, NULL, n) == 0);
+        TEST_CHECKED(RingBufferWo_writeBytes(&rb, NULL, n) == 0);
         TEST(Wo_isReset(&rb, buff, BUFF_SIZE));
 
         memset(buff, 0, n);
@@ -396,6 +841,44 @@ bool RingBufferWo_test(void) {
         TEST(Wo_isReset(&rb, buff, BUFF_SIZE));
     }
 
+    for (size_t cap = 1; cap <= (BUFF_SIZE + 1); ++cap) {
+        // Writes more than the capacity to power-of-two and other capacities.
+        uint8_t data[BUFF_SIZE + 1];
+        uint8_t chunk[3 * (BUFF_SIZE + 1)];
+        for (size_t i = 0; i < sizeof(chunk); ++i) {
+            chunk[i] = (uint8_t)i;
+        }
+        RingBufferWo_initialize(&rb, data, cap);
+        size_t wpos = 0;
+        for (size_t n = 1; n <= (3 * cap); ++n) {
+            TEST(RingBufferWo_writeBytes(&rb, chunk, n) == n);
+            wpos = (wpos + n) % cap;
+            TEST(RingBufferWo_getWriteBytePosition(&rb) == wpos);
+            for (size_t i = 1; i <= ((n < cap) ? n : cap); ++i) {
+                TEST(data[(wpos + cap - i) % cap] == chunk[n - i]);
+            }
+        }
+    }
+
+    uint8_t large[1000];
+    uint8_t large_write[700];
+    for (size_t i = 0; i < sizeof(large_write); ++i) {
+        large_write[i] = (uint8_t)i;
+    }
+    RingBufferWo_initialize(&rb, large, sizeof(large));
+    size_t lpos = 0;
+    for (size_t n = 1; n <= sizeof(large_write); ++n) {
+        // Copies every length through the short, vector and memcpy() paths.
+        TEST(RingBufferWo_writeBytes(&rb, large_write, n) == n);
+        bool same = true;
+        for (size_t i = 0; i < n; ++i) {
+            same = same &&
+                   (large[(lpos + i) % sizeof(large)] == large_write[i]);
+        }
+        TEST(same);
+        lpos = (lpos + n) % sizeof(large);
+    }
+
     printf("%s: passed %llu out of %llu\n", __func__, tests_succeeded,
            tests_run);
 
@@ -32,8 +32,26 @@ extern "C" {
 #endif
 
 extern bool RingBuffer_test(void);
+extern bool RingBufferBroadcast_test(void);
+extern bool RingBufferCpp_test(void);
+extern bool RingBufferDefine_test(void);
+extern bool RingBufferIndex_test(void);
+extern bool RingBufferMpmc_test(void);
+extern bool RingBufferMpsc_test(void);
+extern bool RingBufferMsg_test(void);
 extern bool RingBufferRo_test(void);
+extern bool RingBufferShm_test(void);
+extern bool RingBufferSpsc_test(void);
+extern bool RingBufferStream_test(void);
 extern bool RingBufferWo_test(void);
+extern bool RingBufferWoSeq_test(void);
+#ifdef __linux__
+extern bool RingBufferMirror_test(void);
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+extern bool RingBufferIo_test(void);
+extern bool RingBufferReclaim_test(void);
+#endif
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,143 @@
+/*
+MIT License
+
+Copyright (c) 2025 Henry da Costa
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include "RingBufferTests.h"
+#include "RingBufferWoSeq.h"
+#include "test.h"
+#include <stdio.h>
+#include <string.h>
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+
+#define BUFF_SIZE 15
+#define WRITE_STRING "Hello, world!\n"
+#define TRANSFER_SIZE 1000000
+
+#ifndef __STDC_NO_THREADS__
+// Writes bytes whose values are their write sequences modulo 256.
+static int WoSeq_write(void *arg) {
+    RingBufferWoSeq *rb = (RingBufferWoSeq *)arg;
+    uint8_t value = 0;
+    for (size_t n = 0; n < TRANSFER_SIZE;) {
+        uint8_t chunk[7];
+        for (size_t i = 0; i < sizeof(chunk); ++i) {
+            chunk[i] = (uint8_t)(value + i);
+        }
+        size_t written = RingBufferWoSeq_writeBytes(rb, chunk, sizeof(chunk));
+        value = (uint8_t)(value + written);
+        n += written;
+    }
+    return 0;
+}
+
+static bool WoSeq_read(RingBufferWoSeq *rb) {
+    uint64_t seq = 0;
+    bool success = true;
+    while (seq < TRANSFER_SIZE) {
+        uint8_t chunk[BUFF_SIZE];
+        uint64_t lost;
+        size_t read =
+            RingBufferWoSeq_readBytesAt(rb, seq, chunk, sizeof(chunk), &lost);
+        seq += lost;
+        for (size_t i = 0; i < read; ++i) {
+            success = success && (chunk[i] == (uint8_t)(seq + i));
+        }
+        seq += read;
+    }
+    return success;
+}
+#endif
+
+bool RingBufferWoSeq_test(void) {
+    tests_run = 0;
+    tests_succeeded = 0;
+
+    char buff[BUFF_SIZE];
+    char buff_read[BUFF_SIZE];
+    char buff_writeBytes[BUFF_SIZE];
+    RingBufferWoSeq rb;
+    uint64_t lost;
+
+    strncpy_s(buff_writeBytes, BUFF_SIZE, WRITE_STRING, strlen(WRITE_STRING));
+
+    TEST(!RingBufferWoSeq_initialize(NULL, buff, BUFF_SIZE));
+    TEST(!RingBufferWoSeq_initialize(&rb, NULL, BUFF_SIZE));
+    TEST(!RingBufferWoSeq_initialize(&rb, buff, 0));
+    TEST(RingBufferWoSeq_initialize(&rb, buff, BUFF_SIZE));
+    TEST(RingBufferWoSeq_getByteCapacity(&rb) == BUFF_SIZE);
+    TEST(RingBufferWoSeq_getWriteSequence(&rb) == 0);
+
+    TEST(RingBufferWoSeq_getByteCapacity(NULL) == 0);
+    TEST(RingBufferWoSeq_getWriteSequence(NULL) == 0);
+    TEST(RingBufferWoSeq_writeBytes(NULL, buff_writeBytes, 1) == 0);
+    TEST(RingBufferWoSeq_writeBytes(&rb, NULL, 1) == 0);
+    TEST(RingBufferWoSeq_writeBytes(&rb, buff_writeBytes, 0) == 0);
+    TEST(RingBufferWoSeq_readBytesAt(NULL, 0, buff_read, 1, &lost) == 0);
+    TEST(RingBufferWoSeq_readBytesAt(&rb, 0, NULL, 1, &lost) == 0);
+    TEST(RingBufferWoSeq_readBytesAt(&rb, 0, buff_read, 1, &lost) == 0);
+    TEST(lost == 0);
+
+    for (size_t n = 1; n <= BUFF_SIZE; ++n) {
+        for (size_t p = 0; p <= 2 * BUFF_SIZE; ++p) {
+            // Writes p bytes before the n bytes to read, lapping them when p
+            // is large enough.
+            RingBufferWoSeq_initialize(&rb, buff, BUFF_SIZE);
+            TEST(RingBufferWoSeq_writeBytes(&rb, buff_writeBytes, n) == n);
+            for (size_t i = 0; i < p; ++i) {
+                RingBufferWoSeq_writeBytes(&rb, &buff_writeBytes[i % n], 1);
+            }
+            TEST(RingBufferWoSeq_getWriteSequence(&rb) == n + p);
+
+            size_t left = (n + p <= BUFF_SIZE)   ? n
+                          : (p >= BUFF_SIZE)     ? 0
+                                                 : (BUFF_SIZE - p);
+            memset(buff_read, 0, BUFF_SIZE);
+            TEST(RingBufferWoSeq_readBytesAt(&rb, 0, buff_read, n, &lost) ==
+                 left);
+            TEST(lost == n - left);
+            TEST(strncmp(buff_read, &buff_writeBytes[n - left], left) == 0);
+            TEST(RingBufferWoSeq_readBytesAt(&rb, 0, buff_read, n, NULL) ==
+                 left);
+            TEST(RingBufferWoSeq_readBytesAt(&rb, n + p, buff_read, n,
+                                             &lost) == 0);
+            TEST(lost == 0);
+        }
+    }
+
+#ifndef __STDC_NO_THREADS__
+    {
+        thrd_t writer;
+        RingBufferWoSeq_initialize(&rb, buff, BUFF_SIZE);
+        TEST(thrd_create(&writer, WoSeq_write, &rb) == thrd_success);
+        TEST(WoSeq_read(&rb));
+        TEST(thrd_join(writer, NULL) == thrd_success);
+    }
+#endif
+
+    printf("%s: passed %zu out of %zu\n", __func__, tests_succeeded,
+           tests_run);
+
+    return tests_succeeded == tests_run;
+}
@@ -26,7 +26,19 @@ SOFTWARE.
 #include <stdlib.h>
 
 int main() {
-    return (RingBuffer_test() && RingBufferRo_test() && RingBufferWo_test())
-               ? EXIT_SUCCESS
-               : EXIT_FAILURE;
+    bool success = RingBuffer_test() && RingBufferRo_test() &&
+                   RingBufferWo_test() && RingBufferSpsc_test() &&
+                   RingBufferShm_test() && RingBufferMpsc_test() &&
+                   RingBufferMpmc_test() && RingBufferBroadcast_test() &&
+                   RingBufferWoSeq_test() && RingBufferStream_test() &&
+                   RingBufferMsg_test() && RingBufferIndex_test() &&
+                   RingBufferDefine_test() && RingBufferCpp_test();
+#ifdef __linux__
+    success = success && RingBufferMirror_test();
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+    success = success && RingBufferIo_test();
+    success = success && RingBufferReclaim_test();
+#endif
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
 }
\ No newline at end of file
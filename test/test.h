@@ -17,4 +17,32 @@ extern size_t tests_succeeded;
     }                                                                          \
   } while (0)
 
+// Tests a NULL parameter check, which RINGBUFFER_UNCHECKED removes.
+#ifdef RINGBUFFER_UNCHECKED
+#define TEST_CHECKED(result) ((void)0)
+#else
+#define TEST_CHECKED(result) TEST(result)
+#endif
+
+// strncpy_s is only provided by MSVC and by C libraries that implement
+// Annex K; elsewhere the tests use this equivalent.
+#if !defined(_MSC_VER) && !defined(__STDC_LIB_EXT1__)
+static inline int strncpy_s(char *dest, size_t destsz, const char *src,
+                            size_t count) {
+  size_t i;
+  if ((dest == NULL) || (destsz == 0) || (src == NULL)) {
+    return 1;
+  }
+  for (i = 0; (i < count) && (src[i] != '\0'); ++i) {
+    if (i + 1 >= destsz) {
+      dest[0] = '\0';
+      return 1;
+    }
+    dest[i] = src[i];
+  }
+  dest[i] = '\0';
+  return 0;
+}
+#endif
+
 #endif // _TEST_H